@@ -0,0 +1,108 @@
+// cache.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+// Memoization of match results for steady samples. The color library carries
+// a version that every change bumps, so a cached result is never reused
+// after color or erase.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "eeprom.h"
+#include "led.h"
+#include "lab.h"
+#include "uart0.h"
+#include "format.h"
+#include "cache.h"
+
+MATCH_CACHE matchCache = {0};
+
+// Returns true if two channel values differ by at most epsilon
+static bool withinEpsilon(uint8_t first, uint8_t second, uint8_t epsilon)
+{
+    return ((first > second) ? first - second : second - first) <= epsilon;
+}
+
+// Turn the cache on or off, dropping the cached result and counters
+void configureMatchCache(MATCH_CACHE* cache, bool mode, uint8_t epsilon)
+{
+    cache->mode = mode;
+    cache->valid = false;
+    cache->epsilon = epsilon;
+    cache->hits = 0;
+    cache->misses = 0;
+}
+
+// Copy the cached ranking if it still answers this sample, a search keeping
+// size entries and the current match settings. Returns false, counting a
+// miss, if the search must run.
+bool lookupMatchCache(MATCH_CACHE* cache, uint8_t red, uint8_t green, uint8_t blue, uint8_t size, RANKING* ranking)
+{
+    if(!cache->mode)
+    {
+        return false;
+    }
+
+    if(cache->valid && cache->version == colorVersion
+       && cache->metric == matchMetric && cache->value == matchValue && cache->size == size
+       && withinEpsilon(red, cache->query[0], cache->epsilon)
+       && withinEpsilon(green, cache->query[1], cache->epsilon)
+       && withinEpsilon(blue, cache->query[2], cache->epsilon))
+    {
+        *ranking = cache->ranking;
+        cache->hits++;
+        return true;
+    }
+
+    cache->misses++;
+    return false;
+}
+
+// Remember the sorted ranking a search keeping size entries found for a sample
+void storeMatchCache(MATCH_CACHE* cache, uint8_t red, uint8_t green, uint8_t blue, uint8_t size, const RANKING* ranking)
+{
+    if(!cache->mode)
+    {
+        return;
+    }
+
+    cache->query[0] = red;
+    cache->query[1] = green;
+    cache->query[2] = blue;
+    cache->metric = matchMetric;
+    cache->value = matchValue;
+    cache->size = size;
+    cache->version = colorVersion;
+    cache->ranking = *ranking;
+    cache->valid = true;
+}
+
+// Display hit rate counters
+void printMatchCache(const MATCH_CACHE* cache)
+{
+    uint32_t total = cache->hits + cache->misses;
+
+    sendUart0String(cache->mode ? "  cache on, epsilon " : "  cache off, epsilon ");
+    sendUart0Unsigned(cache->epsilon);
+    sendUart0String(", hits ");
+    sendUart0Unsigned(cache->hits);
+    sendUart0String(", misses ");
+    sendUart0Unsigned(cache->misses);
+
+    if(total > 0)
+    {
+        sendUart0String(", hit rate ");
+        sendUart0Unsigned((cache->hits * 100 + (total >> 1)) / total);
+        sendUart0String("%");
+    }
+
+    sendUart0String("\r\n");
+}
@@ -0,0 +1,55 @@
+// cache.h
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#ifndef CACHE_H_
+#define CACHE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "rank.h"
+
+//
+// Structure Definition
+//
+
+// Result of the last match query. It is reused while each channel of a new
+// sample is within epsilon of the cached query and neither the color library
+// nor the match settings have changed since.
+typedef struct _MATCH_CACHE
+{
+    bool     mode;
+    bool     valid;
+    uint8_t  epsilon;
+    uint8_t  query[3];
+    uint8_t  metric;
+    uint8_t  value;
+    uint8_t  size;                               // entries the search kept
+    uint32_t version;
+    uint32_t hits;
+    uint32_t misses;
+    RANKING  ranking;
+} MATCH_CACHE;
+
+//
+// Global Variables
+//
+extern MATCH_CACHE matchCache;
+
+//
+// Definitions
+//
+void configureMatchCache(MATCH_CACHE* cache, bool mode, uint8_t epsilon);
+bool lookupMatchCache(MATCH_CACHE* cache, uint8_t red, uint8_t green, uint8_t blue, uint8_t size, RANKING* ranking);
+void storeMatchCache(MATCH_CACHE* cache, uint8_t red, uint8_t green, uint8_t blue, uint8_t size, const RANKING* ranking);
+void printMatchCache(const MATCH_CACHE* cache);
+
+#endif /* CACHE_H_ */
@@ -0,0 +1,75 @@
+// clock.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+// System clock setup from the 16 MHz crystal through the 400 MHz PLL (see
+// clock.h). Peripherals derive their own divisors from SYSTEM_CLOCK.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "tm4c123gh6pm.h"
+#include "clock.h"
+
+// Returns the PLL divisor for a system clock in MHz, 0 if it is not supported
+uint8_t pllDivisor(uint32_t mhz)
+{
+    uint32_t divisor;
+
+    if(mhz < MIN_CLOCK_MHZ || (PLL_MHZ % mhz) != 0)
+    {
+        return 0;
+    }
+
+    divisor = PLL_MHZ / mhz;
+
+    return (MIN_PLL_DIVISOR <= divisor && divisor <= MAX_PLL_DIVISOR) ? divisor : 0;
+}
+
+// Returns the power of 2 (1..64) that divides a system clock in MHz down to
+// the nearest PWM clock at or above PWM_CLOCK_MHZ
+uint8_t pwmDivisor(uint32_t mhz)
+{
+    uint8_t divisor = 1;
+
+    while(divisor < 64 && mhz / (divisor * 2) >= PWM_CLOCK_MHZ)
+    {
+        divisor *= 2;
+    }
+
+    return divisor;
+}
+
+// Run the system clock at SYSTEM_CLOCK_MHZ, switching to the PLL once it locks
+void initSystemClock(void)
+{
+    uint8_t divisor = pllDivisor(SYSTEM_CLOCK_MHZ) - 1;
+    uint8_t pwm = pwmDivisor(SYSTEM_CLOCK_MHZ);
+    uint32_t pwmBits = 0;
+
+    // RCC holds the crystal and the PWM divider, whose field codes /2 as 0
+    if(pwm > 1)
+    {
+        for(pwmBits = 0; (2 << pwmBits) < pwm; pwmBits++);
+        pwmBits = SYSCTL_RCC_USEPWMDIV | (pwmBits << SYSCTL_RCC_PWMDIV_S);
+    }
+
+    SYSCTL_RCC_R = SYSCTL_RCC_XTAL_16MHZ | SYSCTL_RCC_OSCSRC_MAIN | SYSCTL_RCC_USESYSDIV | pwmBits;
+
+    // RCC2 overrides the oscillator and divider fields of RCC. DIV400 divides
+    // the PLL output directly, its lowest divisor bit is SYSDIV2LSB.
+    SYSCTL_RCC2_R = SYSCTL_RCC2_USERCC2 | SYSCTL_RCC2_BYPASS2 | SYSCTL_RCC2_OSCSRC2_MO;
+    SYSCTL_RCC2_R = SYSCTL_RCC2_USERCC2 | SYSCTL_RCC2_DIV400 | SYSCTL_RCC2_BYPASS2 | SYSCTL_RCC2_OSCSRC2_MO
+                  | ((uint32_t)(divisor >> 1) << SYSCTL_RCC2_SYSDIV2_S) | ((divisor & 1) ? SYSCTL_RCC2_SYSDIV2LSB : 0);
+
+    while(!(SYSCTL_RIS_R & SYSCTL_RIS_PLLLRIS));
+
+    SYSCTL_RCC2_R &= ~SYSCTL_RCC2_BYPASS2;
+}
@@ -0,0 +1,49 @@
+// clock.h
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#ifndef CLOCK_H_
+#define CLOCK_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//
+// Defines
+//
+
+// System clock the firmware is built for, every peripheral timing derives
+// from it. The 400 MHz PLL output is divided by 5 or more, and the ADC needs
+// at least 16 MHz, so 80, 50, 40, 25, 20 and 16 MHz are supported. A build can
+// define a lower one to save power.
+#ifndef SYSTEM_CLOCK_MHZ
+#define SYSTEM_CLOCK_MHZ   80
+#endif
+#define SYSTEM_CLOCK       (SYSTEM_CLOCK_MHZ * 1000000)
+
+#define PLL_MHZ            400
+#define MIN_PLL_DIVISOR    5                     // 80 MHz
+#define MAX_PLL_DIVISOR    128
+#define MIN_CLOCK_MHZ      16
+#define PWM_CLOCK_MHZ      20                    // PWM clock the LED period is set for
+
+#if (PLL_MHZ % SYSTEM_CLOCK_MHZ) != 0 || (PLL_MHZ / SYSTEM_CLOCK_MHZ) < MIN_PLL_DIVISOR || SYSTEM_CLOCK_MHZ < MIN_CLOCK_MHZ
+#error "SYSTEM_CLOCK_MHZ is not a supported system clock"
+#endif
+
+//
+// Definitions
+//
+uint8_t pllDivisor(uint32_t mhz);
+uint8_t pwmDivisor(uint32_t mhz);
+void initSystemClock(void);
+
+#endif /* CLOCK_H_ */
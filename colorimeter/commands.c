@@ -0,0 +1,952 @@
+// commands.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "tm4c123gh6pm.h"
+#include "gpio.h"
+#include "uart0.h"
+#include "shell.h"
+#include "reboot.h"
+#include "wait.h"
+#include "pwm0.h"
+#include "timers.h"
+#include "led.h"
+#include "eeprom.h"
+#include "format.h"
+#include "lab.h"
+#include "macros.h"
+#include "model.h"
+#include "rank.h"
+#include "stable.h"
+#include "cache.h"
+#include "cycles.h"
+#include "journal.h"
+#include "logger.h"
+#include "schedule.h"
+#include "interrupts.h"
+#include "tasks.h"
+#include "timestamp.h"
+#include "profile.h"
+#include "stats.h"
+#include "commands.h"
+
+// Blocking function that returns only when SW1 is pressed
+void waitPbPress(void)
+{
+    //wait until push button pressed
+    while(getPinValue(PUSH_BUTTON));
+
+    //wait specified time
+    waitMicrosecond(10000);
+}
+
+// Returns true if token is a valid color reference index
+static bool validColorIndex(int32_t index)
+{
+    if(0 <= index && index < TOTAL_COLORS)
+    {
+        return true;
+    }
+
+    sendUart0String("  Color index NOT in 0 to ");
+    sendUart0Unsigned(TOTAL_COLORS - 1);
+    sendUart0String(" range.\r\n");
+
+    return false;
+}
+
+// Store Learned Colors in EEPROM before reseting device
+static void commandReset(USER_DATA* data)
+{
+    storeColors();
+
+    // Set flag for micro-controller reboot
+    rebootFlag = true;
+}
+
+// Instructs the hardware to calibrate the white color balance
+// and displays the duty cycle information when complete
+static void commandCalibrate(USER_DATA* data)
+{
+    threshold = getFieldInteger(data, 1);
+
+    calibrateMode = true;
+    testMode = false;
+    calibrateLed(threshold);
+
+    //turn off LEDs when finished with test
+    setRgbColor(0,0,0);
+
+    //keep the calibration across resets
+    if(validCalibration && autoCommit)
+    {
+        requestCommit(COMMIT_SETTINGS);
+    }
+}
+
+//Stores the current color as color reference N (N = 0..TOTAL_COLORS-1). With
+//K samples the mean is stored along with a class model of their spread.
+static void commandColor(USER_DATA* data)
+{
+    bool flag = false;
+    int32_t index, samples = 1;
+    COLOR_STATS stats;
+    uint8_t mean[3];
+
+    index = getFieldInteger(data, 1);
+
+    if(!validColorIndex(index))
+    {
+        return;
+    }
+
+    if(data->fieldCount > 2)
+    {
+        samples = getFieldInteger(data, 2);
+
+        if(samples < 1 || samples > MAX_SAMPLES)
+        {
+            sendUart0String("  Sample count NOT in 1 to ");
+            sendUart0Unsigned(MAX_SAMPLES);
+            sendUart0String(" range.\r\n");
+            return;
+        }
+    }
+
+    color.index = index;
+
+    if(samples == 1)
+    {
+        //turn deltaMode off to print values when using trigger.
+        if(delta.mode)
+        {
+            delta.mode = false;
+            flag = true;
+        }
+
+        //take measurement and store value
+        getMeasurement();
+
+        setColor(color.index, ledRed, ledGreen, ledBlue);
+
+        //turn deltaMode back on if it was in that state when entering the command
+        if(flag == true)
+        {
+            delta.mode = true;
+        }
+    }
+    else if(!validCalibration)
+    {
+        sendUart0String("  NO calibration performed.\r\n");
+        return;
+    }
+    else
+    {
+        resetColorStats(&stats);
+
+        while(stats.count < samples)
+        {
+            measureRgb();
+            addColorSample(&stats, ledRed, ledGreen, ledBlue);
+        }
+
+        getColorMean(&stats, mean);
+        setColor(color.index, mean[0], mean[1], mean[2]);
+        setColorModel(color.index, getColorModel(&stats));
+
+        sendUart0String("  ");
+        sendUart0Triplet(mean[0], mean[1], mean[2]);
+        sendUart0String("\r\n");
+    }
+
+    //write the new color through to EEPROM unless commits are batched
+    if(autoCommit)
+    {
+        requestCommit(COMMIT_COLORS);
+    }
+
+    sendUart0String("  color ");
+    sendUart0Unsigned(color.index);
+    sendUart0String(" stored.\r\n");
+}
+
+//Erases color reference N (N = 0..TOTAL_COLORS-1)
+static void commandErase(USER_DATA* data)
+{
+    int index;
+
+    index = getFieldInteger(data, 1);
+
+    if(!validColorIndex(index))
+    {
+        return;
+    }
+
+    //delete color from user input
+    if(isColorValid(index))
+    {
+        // Erase color in RAM and EEPROM
+        eraseColor(index);
+
+        //print raw results in comparison
+        sendUart0String("  color ");
+        sendUart0Unsigned(index);
+        sendUart0String(" erased.\r\n");
+    }
+    else
+    {
+        sendUart0String("  NO color to erase.\r\n");
+    }
+}
+
+// Configures the hardware to send an RGB triplet in 8-bit calibrated format
+// every 0.1 x T seconds, where T = 0..255 or off. With a unit T is a rate in
+// HZ or a period in MS or US instead, from 1 ms up to about 71 minutes. T may
+// be a fraction, e.g. 2.5 HZ. Without T the requested and achieved rates are
+// displayed.
+static void commandPeriodic(USER_DATA* data)
+{
+    int32_t value = getFieldFixed(data, 1);
+    const char* unit = getFieldView(data, 2);
+    uint32_t period;
+
+    if(data->fieldCount < 2)
+    {
+        printSchedule(&schedule);
+        return;
+    }
+
+    if(value < 0)
+    {
+        sendUart0String("  Period NOT valid.\r\n");
+        return;
+    }
+
+    if(strcmp(unit, "hz") == 0)
+    {
+        // value is in mHz. Rates of 1 MHz and up round to 1 us, which
+        // startPeriodic() refuses.
+        if(value == 0)
+        {
+            period = 0;
+        }
+        else
+        {
+            period = (value >= 1000000000) ? 1 : (1000000000 + (value >> 1)) / value;
+        }
+    }
+    else if(strcmp(unit, "ms") == 0)
+    {
+        period = getFieldScaled(data, 1, 1000);
+    }
+    else if(strcmp(unit, "us") == 0)
+    {
+        period = getFieldScaled(data, 1, 1);
+    }
+    else if(unit[0] == '\0' && value <= 255 * FIXED_POINT_SCALE)
+    {
+        period = getFieldScaled(data, 1, 100000);
+    }
+    else
+    {
+        sendUart0String("  Period NOT valid.\r\n");
+        return;
+    }
+
+    if(!validCalibration)
+    {
+        sendUart0String("  NO calibration performed.\r\n");
+    }
+    else
+    {
+        periodicT(period);
+    }
+}
+
+// Display the worst interrupt latencies and the deferred work counters
+static void commandIrq(USER_DATA* data)
+{
+    printInterrupts();
+}
+
+// Display the cycles spent at each probe point, or clear them
+static void commandProf(USER_DATA* data)
+{
+    if(strcmp(getFieldView(data, 1), "reset") == 0)
+    {
+        resetProfile();
+    }
+    else
+    {
+        printProfile();
+    }
+}
+
+// Display the busy percentage and the task counters
+static void commandTasks(USER_DATA* data)
+{
+    printTasks(&scheduler);
+}
+
+// Display the health counters as text or as a binary frame, and with S after
+// the format report them that way every S seconds. OFF stops the reports,
+// RESET clears the counters.
+static void commandStats(USER_DATA* data)
+{
+    const char* mode = getFieldView(data, 1);
+    int32_t seconds = getFieldInteger(data, 2);
+    uint8_t format = STATS_TEXT;
+
+    if(strcmp(mode, "reset") == 0)
+    {
+        resetStats();
+        return;
+    }
+    else if(strcmp(mode, "off") == 0)
+    {
+        stopStatsReport();
+        return;
+    }
+    else if(strcmp(mode, "bin") == 0)
+    {
+        format = STATS_BINARY;
+    }
+    else if(mode[0] != '\0' && strcmp(mode, "text") != 0)
+    {
+        sendUart0String("  Format NOT known.\r\n");
+        return;
+    }
+
+    if(data->fieldCount > 2)
+    {
+        if(seconds < 1 || seconds > MAX_STATS_PERIOD)
+        {
+            sendUart0String("  Period NOT in 1 to ");
+            sendUart0Unsigned(MAX_STATS_PERIOD);
+            sendUart0String(" s range.\r\n");
+            return;
+        }
+
+        statsFormat = format;
+        startStatsReport(seconds);
+    }
+
+    reportStats(format);
+}
+
+// Start each sample record with the time of the sample, or display the time
+// since boot
+static void commandTime(USER_DATA* data)
+{
+    const char* mode = getFieldView(data, 1);
+
+    if(strcmp(mode, "on") == 0)
+    {
+        stampMode = true;
+    }
+    else if(strcmp(mode, "off") == 0)
+    {
+        stampMode = false;
+    }
+    else
+    {
+        sendUart0String("  time ");
+        sendUart0Timestamp(readTimestamp());
+        sendUart0String(" s, stamps ");
+        sendUart0String(stampMode ? "on" : "off");
+        sendUart0String("\r\n");
+    }
+}
+
+// Choose what happens when a periodic sample runs past the next deadline
+static void commandOverrun(USER_DATA* data)
+{
+    const char* policy = getFieldView(data, 1);
+
+    if(strcmp(policy, "skip") == 0)
+    {
+        schedule.policy = OVERRUN_SKIP;
+    }
+    else if(strcmp(policy, "stretch") == 0)
+    {
+        schedule.policy = OVERRUN_STRETCH;
+    }
+    else if(strcmp(policy, "degrade") == 0)
+    {
+        schedule.policy = OVERRUN_DEGRADE;
+    }
+    else
+    {
+        sendUart0String("  Policy NOT known.\r\n");
+    }
+}
+
+// Sets how long the sensor settles under each LED before it is read, in us.
+// Shorter settling allows shorter periods at the cost of accuracy.
+static void commandSettle(USER_DATA* data)
+{
+    int32_t time = getFieldInteger(data, 1);
+    uint32_t previous = settleTime;
+
+    if(data->fieldCount < 2)
+    {
+        sendUart0String("  settle ");
+        sendUart0Unsigned(settleTime);
+        sendUart0String(" us, a measurement takes ");
+        sendUart0Unsigned(measurementTime());
+        sendUart0String(" us\r\n");
+        return;
+    }
+
+    if(time < MIN_SETTLE_TIME || time > MAX_SETTLE_TIME)
+    {
+        sendUart0String("  Settle time NOT in ");
+        sendUart0Unsigned(MIN_SETTLE_TIME);
+        sendUart0String(" to ");
+        sendUart0Unsigned(MAX_SETTLE_TIME);
+        sendUart0String(" us range.\r\n");
+        return;
+    }
+
+    settleTime = time;
+
+    // The running period must still fit a measurement
+    if(periodicMode && measurementTime() > periodicValue)
+    {
+        settleTime = previous;
+        sendUart0String("  Settle time NOT possible at the current period.\r\n");
+    }
+}
+
+// Configures the hardware to send an RGB triplet when the RMS average
+// of the RGB triplet vs the long-term average (IIR filtered, alpha = 0.9)
+// changes by more than D, where D = 0..255 or off
+static void commandDelta(USER_DATA* data)
+{
+    delta.value = getFieldInteger(data, 1);
+
+    startPeriodic(periodicValue);
+
+    if(delta.value < 0)
+    {
+        delta.value = 0;
+    }
+    else if(delta.value > 255)
+    {
+        delta.value = 255;
+    }
+
+    delta.mode = true;
+}
+
+// Configures the hardware to send an RGB triplet when the Euclidean
+// distance (error) between a sample and one of the color reference (R,G,B)
+// is less than E, where E = 0..255 or off. With LAB the error is the CIE76
+// difference between the L*a*b* values instead.
+static void commandMatch(USER_DATA* data)
+{
+    matchValue = getFieldInteger(data, 1);
+    matchMetric = (strcmp(getFieldView(data, 2), "lab") == 0) ? MATCH_LAB : MATCH_RGB;
+
+    startPeriodic(periodicValue);
+
+    if(matchValue == 0)
+    {
+        matchMode = false;
+    }
+    else if (matchValue < 256)
+    {
+        matchMode = true;
+    }
+}
+
+// Write changed colors and settings to EEPROM now and report the cost, or
+// choose between writing each change through as it happens (AUTO) and
+// batching changes until the next commit or reset (MANUAL)
+static void commandCommit(USER_DATA* data)
+{
+    const char* mode = getFieldView(data, 1);
+    uint16_t committed;
+
+    if(strcmp(mode, "auto") == 0)
+    {
+        autoCommit = true;
+        commitColors();
+    }
+    else if(strcmp(mode, "manual") == 0)
+    {
+        autoCommit = false;
+    }
+    else
+    {
+        committed = commitColors();
+        commitSettings();
+
+        sendUart0String("  ");
+        sendUart0Unsigned(committed);
+        sendUart0String(" colors committed in ");
+        sendUart0Unsigned(cyclesToMicroseconds(commitStats.lastCycles));
+        sendUart0String(" us, max ");
+        sendUart0Unsigned(cyclesToMicroseconds(commitStats.maxCycles));
+        sendUart0String(" us\r\n");
+
+        printJournal();
+    }
+}
+
+// Reuse the match result while each channel of the sample stays within
+// epsilon of the cached query, or turn the cache off. Without an argument the
+// hit rate counters are displayed.
+static void commandCache(USER_DATA* data)
+{
+    int32_t epsilon;
+
+    if(data->fieldCount < 2)
+    {
+        printMatchCache(&matchCache);
+    }
+    else if(strcmp(getFieldView(data, 1), "off") == 0)
+    {
+        configureMatchCache(&matchCache, false, 0);
+    }
+    else
+    {
+        epsilon = getFieldInteger(data, 1);
+
+        if(epsilon < 0 || epsilon > 255)
+        {
+            sendUart0String("  Epsilon NOT in 0 to 255 range.\r\n");
+            return;
+        }
+
+        configureMatchCache(&matchCache, true, epsilon);
+    }
+}
+
+// Sets how many of the closest matching references are reported, K = 1..7,
+// and whether the match record is text or CSV
+static void commandRank(USER_DATA* data)
+{
+    int32_t size = getFieldInteger(data, 1);
+    const char* format = getFieldView(data, 2);
+
+    if(size < 1 || size >= MAX_RANK)
+    {
+        sendUart0String("  Rank NOT in 1 to ");
+        sendUart0Unsigned(MAX_RANK - 1);
+        sendUart0String(" range.\r\n");
+        return;
+    }
+
+    rankSize = size;
+
+    if(strcmp(format, "csv") == 0)
+    {
+        rankFormat = RANK_CSV;
+    }
+    else if(strcmp(format, "text") == 0)
+    {
+        rankFormat = RANK_TEXT;
+    }
+}
+
+// Report a match only once it wins M of the last N samples and has been the
+// best match D samples in a row, and then only when it changes. M defaults to
+// a simple majority and D to 1.
+static void commandStable(USER_DATA* data)
+{
+    int32_t window, majority, dwell = 1;
+
+    if(strcmp(getFieldView(data, 1), "off") == 0)
+    {
+        stable.mode = false;
+        return;
+    }
+
+    window = getFieldInteger(data, 1);
+    majority = (data->fieldCount > 2) ? getFieldInteger(data, 2) : (window / 2) + 1;
+
+    if(data->fieldCount > 3)
+    {
+        dwell = getFieldInteger(data, 3);
+    }
+
+    if(window < 1 || window > MAX_WINDOW || majority < 1 || majority > window || dwell < 1 || dwell > 255)
+    {
+        sendUart0String("  Use N = 1 to ");
+        sendUart0Unsigned(MAX_WINDOW);
+        sendUart0String(", M = 1 to N, D = 1 to 255.\r\n");
+        return;
+    }
+
+    configureStabilizer(&stable, window, majority, dwell);
+    stable.mode = true;
+}
+
+// Configures the hardware to send an RGB triplet immediately
+static void commandTrigger(USER_DATA* data)
+{
+    delta.mode = false;
+
+    getMeasurement();
+}
+
+// Turn logging of every sample to flash on or off, or erase the log. Without
+// an argument the log usage is displayed.
+static void commandLog(USER_DATA* data)
+{
+    const char* mode = getFieldView(data, 1);
+
+    if(strcmp(mode, "on") == 0)
+    {
+        logMode = true;
+    }
+    else if(strcmp(mode, "off") == 0)
+    {
+        logMode = false;
+        flushLog();
+    }
+    else if(strcmp(mode, "clear") == 0)
+    {
+        clearLog();
+        sendUart0String("  log cleared.\r\n");
+    }
+    else
+    {
+        printLog();
+    }
+}
+
+// Stream every logged sample, oldest first
+static void commandDump(USER_DATA* data)
+{
+    dumpLog();
+}
+
+// Configures the hardware to send an RGB triplet when the PB is pressed
+static void commandButton(USER_DATA* data)
+{
+    delta.mode = false;
+
+    sendUart0String("  Press Push Button to Continue.\r\n");
+
+    // Wait for PB press
+    waitPbPress();
+
+    // Get Measurement after PB pressed
+    getMeasurement();
+}
+
+// Manipulate green status LED
+static void commandLed(USER_DATA* data)
+{
+    const char* buffer = getFieldView(data, 1);
+
+    //Disable the green status LED
+    if(strcmp(buffer, "off") == 0)
+    {
+        setPinValue(GREEN_LED, 0); // Turn off GREEN_LED
+
+        sampleLed = false;
+    }
+    else if(strcmp(buffer, "on") == 0) //Enable the green status LED
+    {
+        setPinValue(GREEN_LED, 1); // Turn on GREEN_LED
+
+        sampleLed = false;
+    }
+    else if(strcmp(buffer, "sample") == 0) //Blinks the green status LED for each sample taken
+    {
+        sampleLed = true;
+    }
+}
+
+//Drives up the LED from a DC of 0 to 255 on red, green, and blue LEDs
+//separately and outputs the uncalibrated 12-bit light intensity in tabular form
+static void commandTest(USER_DATA* data)
+{
+    calibrateMode = false;
+    testMode = true;
+    testLED();              //perform test of r,g,b LEDs
+    setRgbColor(0,0,0);     //turn off LEDs when finished with test
+}
+
+// Turn test output on (as CSV or delta encoded) or off, or display the last
+// captured ramp table or learned colors
+static void commandPrint(USER_DATA* data)
+{
+    const char* buffer = getFieldView(data, 1);
+
+    if(strcmp(buffer, "off") == 0)
+    {
+        printTest = false;
+    }
+    else if(strcmp(buffer, "on") == 0)
+    {
+        printTest = true;
+        rampFormat = RAMP_CSV;
+    }
+    else if(strcmp(buffer, "delta") == 0)
+    {
+        printTest = true;
+        rampFormat = RAMP_DELTA;
+    }
+    else if(strcmp(buffer, "table") == 0)
+    {
+        printRampTable();
+    }
+    else if(strcmp(buffer, "colors") == 0)
+    {
+        printLearnedColors();
+    }
+}
+
+// Set RGB LED duty cycles directly
+static void commandSet(USER_DATA* data)
+{
+    uint16_t red, green, blue;
+
+    // Get RGB values
+    red = getFieldInteger(data, 1);
+    green = getFieldInteger(data, 2);
+    blue = getFieldInteger(data, 3);
+
+    // Set RGB  values
+    setRgbColor(red, green, blue);
+}
+
+// Define or erase a macro, or list stored macros: macro [NAME = CMD; CMD]
+static void commandMacro(USER_DATA* data)
+{
+    const char* name = getFieldView(data, 1);
+    const char* body = getFieldView(data, 2);
+
+    if(data->fieldCount < 3)
+    {
+        printMacros();
+    }
+    else if(findCommand(name) != 0)
+    {
+        sendUart0String("  Macro name is already a command.\r\n");
+    }
+    else if(!storeMacro(name, body))
+    {
+        sendUart0String("  Macro NOT stored.\r\n");
+    }
+    else if(body[0] == '\0')
+    {
+        sendUart0String("  macro erased.\r\n");
+    }
+    else
+    {
+        sendUart0String("  macro stored.\r\n");
+    }
+}
+
+// Command table, kept in flash and sorted by name for findCommand()
+const COMMAND commandTable[] =
+{
+    {"button",    1, "",    SAMPLING_PAUSED,     "button",                          commandButton},
+    {"cache",     1, "O",   SAMPLING_HELD,       "cache [EPSILON|OFF]",             commandCache},
+    {"calibrate", 2, "N",   SAMPLING_PAUSED,     "calibrate N",                     commandCalibrate},
+    {"color",     2, "NN",  SAMPLING_PAUSED,     "color N [K]",                     commandColor},
+    {"commit",    1, "A",   SAMPLING_CONCURRENT, "commit [AUTO|MANUAL]",            commandCommit},
+    {"delta",     2, "O",   SAMPLING_HELD,       "delta D",                         commandDelta},
+    {"dump",      1, "",    SAMPLING_PAUSED,     "dump",                            commandDump},
+    {"erase",     2, "N",   SAMPLING_HELD,       "erase N",                         commandErase},
+    {"irq",       1, "",    SAMPLING_CONCURRENT, "irq",                             commandIrq},
+    {"led",       2, "A",   SAMPLING_CONCURRENT, "led OFF|ON|SAMPLE",               commandLed},
+    {"log",       1, "A",   SAMPLING_HELD,       "log [ON|OFF|CLEAR]",              commandLog},
+    {"macro",     1, "AR",  SAMPLING_CONCURRENT, "macro NAME = CMD; CMD",           commandMacro},
+    {"match",     2, "OA",  SAMPLING_HELD,       "match E [RGB|LAB]",               commandMatch},
+    {"overrun",   2, "A",   SAMPLING_CONCURRENT, "overrun SKIP|STRETCH|DEGRADE",    commandOverrun},
+    {"periodic",  1, "PA",  SAMPLING_HELD,       "periodic [T [HZ|MS|US]]",         commandPeriodic},
+    {"print",     2, "A",   SAMPLING_CONCURRENT, "print ON|OFF|DELTA|TABLE|COLORS", commandPrint},
+    {"prof",      1, "A",   SAMPLING_CONCURRENT, "prof [RESET]",                    commandProf},
+    {"rank",      2, "NA",  SAMPLING_HELD,       "rank K [TEXT|CSV]",               commandRank},
+    {"reset",     1, "",    SAMPLING_CONCURRENT, "reset",                           commandReset},
+    {"set",       4, "NNN", SAMPLING_PAUSED,     "set R G B",                       commandSet},
+    {"settle",    1, "N",   SAMPLING_HELD,       "settle [US]",                     commandSettle},
+    {"stable",    2, "ONN", SAMPLING_HELD,       "stable N [M] [D]|OFF",            commandStable},
+    {"stats",     1, "AN",  SAMPLING_CONCURRENT, "stats [TEXT|BIN [S]|RESET|OFF]",  commandStats},
+    {"tasks",     1, "",    SAMPLING_CONCURRENT, "tasks",                           commandTasks},
+    {"test",      1, "",    SAMPLING_PAUSED,     "test",                            commandTest},
+    {"time",      1, "A",   SAMPLING_CONCURRENT, "time [ON|OFF]",                   commandTime},
+    {"trigger",   1, "",    SAMPLING_HELD,       "trigger",                         commandTrigger},
+};
+
+#define COMMAND_COUNT (sizeof(commandTable) / sizeof(commandTable[0]))
+
+const uint8_t commandCount = COMMAND_COUNT;
+
+// Binary search of the command table, returns 0 if name is not a command
+const COMMAND* findCommand(const char name[])
+{
+    int8_t low = 0, high = COMMAND_COUNT - 1, middle;
+    int compare;
+
+    while(low <= high)
+    {
+        middle = (low + high) >> 1;
+        compare = strcmp(name, commandTable[middle].name);
+
+        if(compare == 0)
+        {
+            return &commandTable[middle];
+        }
+        else if(compare < 0)
+        {
+            high = middle - 1;
+        }
+        else
+        {
+            low = middle + 1;
+        }
+    }
+
+    return 0;
+}
+
+// Check field count and field types against the command's argument schema
+bool validArguments(USER_DATA* data, const COMMAND* command)
+{
+    uint8_t i, field;
+    char type;
+
+    if(data->fieldCount < command->minFields)
+    {
+        return false;
+    }
+
+    for(i = 0; command->arguments[i] != '\0'; i++)
+    {
+        field = i + 1;
+
+        if(field >= data->fieldCount)
+        {
+            break;
+        }
+
+        type = data->field[field].type;
+
+        switch(command->arguments[i])
+        {
+            case 'F':
+                if(type != 'N' && type != 'F')
+                {
+                    return false;
+                }
+                break;
+            case 'O':
+                if(type != 'N' && strcmp(getFieldView(data, field), "off") != 0)
+                {
+                    return false;
+                }
+                break;
+            case 'P':
+                if(type != 'N' && type != 'F' && strcmp(getFieldView(data, field), "off") != 0)
+                {
+                    return false;
+                }
+                break;
+            default:
+                if(command->arguments[i] != type)
+                {
+                    return false;
+                }
+                break;
+        }
+    }
+
+    return true;
+}
+
+// Run the commands stored in a macro. Returns false if no macro has the name.
+static bool runMacro(const char name[])
+{
+    static uint8_t depth = 0;
+    USER_DATA macro = {0};
+
+    if(!loadMacro(name, macro.buffer))
+    {
+        return false;
+    }
+
+    if(depth >= MAX_MACRO_DEPTH)
+    {
+        sendUart0String("  Macros nested too deeply.\r\n");
+        return true;
+    }
+
+    depth++;
+    executeCommands(&macro);
+    depth--;
+
+    return true;
+}
+
+// Look up the first field of the user input and run its handler, or the
+// macro of the same name. Periodic sampling is paused or held around the
+// handler as its table entry asks.
+void dispatchCommand(USER_DATA* data)
+{
+    const COMMAND* command;
+    bool running, held;
+
+    if(data->fieldCount == 0)
+    {
+        return;
+    }
+
+    command = findCommand(getFieldView(data, 0));
+
+    if(command == 0)
+    {
+        if(!runMacro(getFieldView(data, 0)))
+        {
+            sendUart0String("  Invalid command.\r\n");
+        }
+    }
+    else if(!validArguments(data, command))
+    {
+        sendUart0String("  Usage: ");
+        sendUart0StringLiteral(command->usage);
+        sendUart0String("\r\n");
+    }
+    else if(command->sampling == SAMPLING_PAUSED)
+    {
+        running = pauseSampling();
+        command->handler(data);
+        resumeSampling(running);
+    }
+    else if(command->sampling == SAMPLING_HELD)
+    {
+        held = holdSampling();
+        command->handler(data);
+        releaseSampling(held);
+    }
+    else
+    {
+        command->handler(data);
+    }
+}
+
+// Tokenize and run every ';' separated command of the user input in turn
+void executeCommands(USER_DATA* data)
+{
+    while(parseFields(data))
+    {
+        dispatchCommand(data);
+    }
+}
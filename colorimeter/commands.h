@@ -0,0 +1,64 @@
+// commands.h
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#ifndef COMMANDS_H_
+#define COMMANDS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "shell.h"
+
+//
+// Defines
+//
+#define SAMPLING_CONCURRENT 0                   // runs while samples keep coming
+#define SAMPLING_HELD       1                   // changes state the sampling ISR uses
+#define SAMPLING_PAUSED     2                   // drives the LEDs or sensor itself
+
+//
+// Structure Definition
+//
+typedef void (*COMMAND_HANDLER)(USER_DATA* data);
+
+// One entry of the command table. The table is kept sorted by name so it can
+// be searched with a binary search. minFields counts the command itself, the
+// same way isCommand() does. Each character of arguments describes one
+// argument: 'N' numeric, 'F' numeric that may be a fraction, 'A' alpha,
+// 'O' numeric or "off", 'P' numeric that may be a fraction or "off", 'R' raw
+// text.
+// sampling says how the command runs alongside periodic sampling.
+typedef struct _COMMAND
+{
+    const char*     name;
+    uint8_t         minFields;
+    const char*     arguments;
+    uint8_t         sampling;
+    const char*     usage;
+    COMMAND_HANDLER handler;
+} COMMAND;
+
+//
+// Global Variables
+//
+extern const COMMAND commandTable[];
+extern const uint8_t commandCount;
+
+//
+// Definitions
+//
+const COMMAND* findCommand(const char name[]);
+bool validArguments(USER_DATA* data, const COMMAND* command);
+void dispatchCommand(USER_DATA* data);
+void executeCommands(USER_DATA* data);
+void waitPbPress(void);
+
+#endif /* COMMANDS_H_ */
@@ -0,0 +1,38 @@
+// cycles.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+// Free-running 32-bit count of core clock cycles from the DWT unit, used to
+// time short operations. It wraps after about 53 s at 80 MHz, so the
+// difference of two readings is valid for anything shorter.
+
+#include <stdint.h>
+#include "cycles.h"
+
+// Function to start the DWT cycle counter
+void initCycleCounter(void)
+{
+    CORE_DEMCR_R |= CORE_DEMCR_TRCENA;
+    DWT_CYCCNT_R = 0;
+    DWT_CTRL_R |= DWT_CTRL_CYCCNTENA;
+}
+
+// Returns the current cycle count
+uint32_t readCycleCounter(void)
+{
+    return DWT_CYCCNT_R;
+}
+
+// Convert an elapsed cycle count to microseconds
+uint32_t cyclesToMicroseconds(uint32_t cycles)
+{
+    return cycles / CYCLES_PER_MICROSECOND;
+}
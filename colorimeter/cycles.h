@@ -0,0 +1,39 @@
+// cycles.h
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#ifndef CYCLES_H_
+#define CYCLES_H_
+
+#include <stdint.h>
+#include "clock.h"
+
+//
+// Defines
+//
+
+// Cortex-M4 debug registers, not part of tm4c123gh6pm.h
+#define CORE_DEMCR_R          (*((volatile uint32_t *)0xE000EDFC))
+#define CORE_DEMCR_TRCENA     0x01000000
+#define DWT_CTRL_R            (*((volatile uint32_t *)0xE0001000))
+#define DWT_CTRL_CYCCNTENA    0x00000001
+#define DWT_CYCCNT_R          (*((volatile uint32_t *)0xE0001004))
+
+#define CYCLES_PER_MICROSECOND SYSTEM_CLOCK_MHZ
+
+//
+// Definitions
+//
+void initCycleCounter(void);
+uint32_t readCycleCounter(void);
+uint32_t cyclesToMicroseconds(uint32_t cycles);
+
+#endif /* CYCLES_H_ */
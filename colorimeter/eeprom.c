@@ -1,118 +1,601 @@
-// eeprom.h
-// William Bozarth
-// Created on: October 7, 2020
-
-//-----------------------------------------------------------------------------
-// Hardware Target
-//-----------------------------------------------------------------------------
-
-// Target Platform: EK-TM4C123GXL Evaluation Board
-// Target uC:       TM4C123GH6PM
-// System Clock:    40 MHz
-
-
-#include <stdlib.h>
-#include <string.h>
-#include <stdint.h>
-#include "tm4c123gh6pm.h"
-#include "eeprom.h"
-#include "uart0.h"
-
-STORED_COLORS color = {0};
-
-int threshold = 0;
-bool validCalibration = false;
-bool calibrateMode = false;
-
-// Function to initialize EEPROM
-void initEeprom(void)
-{
-    SYSCTL_RCGCEEPROM_R = 1;
-    _delay_cycles(6);
-    while (EEPROM_EEDONE_R & EEPROM_EEDONE_WORKING);
-}
-
-// Function to write data to EEPROM
-void writeEeprom(uint16_t add, uint32_t data)
-{
-    EEPROM_EEBLOCK_R = add >> 4; // Shift right 4 bits is same as dividing address by 16
-    EEPROM_EEOFFSET_R = add & 0xF;
-    EEPROM_EERDWR_R = data;
-    while (EEPROM_EEDONE_R & EEPROM_EEDONE_WORKING);
-}
-
-// Function to read data from EEPROM
-uint32_t readEeprom(uint16_t add)
-{
-    EEPROM_EEBLOCK_R = add >> 4;
-    EEPROM_EEOFFSET_R = add & 0xF;
-    return EEPROM_EERDWR_R;
-}
-
-// Store Color in EEPROM
-void storeColors(void)
-{
-    uint16_t i;
-    for(i = 0; i < 16; i++)
-    {
-        if(color.validBit[i])
-        {
-            writeEeprom((16 * i), (uint32_t)color.validBit[i]);
-            writeEeprom((16 * i) + 1, color.redValue[i]);
-            writeEeprom((16 * i) + 2, color.greenValue[i]);
-            writeEeprom((16 * i) + 3, color.blueValue[i]);
-        }
-    }
-}
-
-// Load colors stored in EEPROM
-void loadColors(void)
-{
-    uint32_t num;
-
-    for(int i = 0; i < 16; i++)
-    {
-        if((num = readEeprom(16*i)) != 0xFFFFFFFF)
-        {
-            color.validBit[i]   = (bool)num;
-            color.redValue[i]   = readEeprom(16*i + 1);
-            color.greenValue[i] = readEeprom(16*i + 2);
-            color.blueValue[i]  = readEeprom(16*i + 3);
-        }
-    }
-}
-
-// Erase color specified by user
-void eraseColor(int index)
-{
-    int i;
-
-    writeEeprom((16 * index), 0xFFFFFFFF);
-
-    for(i = 1; i < 4; i++)
-    {
-        writeEeprom((16 * index) + i, 0xFFFFFFFF);
-    }
-}
-
-
-// Displays all colors learned by device for user
-void printLearnedColors(void)
-{
-    int i;
-    char buffer[25];
-
-    for(i = 0; i < 16; i++)
-    {
-        if(color.validBit[i])
-        {
-            snprintf(buffer, sizeof(buffer), "  color %u: %u,%u,%u\r\n", i, color.redValue[i], color.greenValue[i], color.blueValue[i]);
-            sendUart0String(buffer);
-        }
-        else
-        {
-            snprintf(buffer, sizeof(buffer), "  color %u: none\r\n", i);
-            sendUart0String(buffer);
-        }
-    }
-}
+// eeprom.h
+// William Bozarth
+// Created on: October 7, 2020
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "tm4c123gh6pm.h"
+#include "eeprom.h"
+#include "uart0.h"
+#include "format.h"
+#include "grid.h"
+#include "lab.h"
+#include "model.h"
+#include "cycles.h"
+#include "journal.h"
+#include "led.h"
+#include "rank.h"
+#include "stable.h"
+#include "tasks.h"
+#include "stats.h"
+#include "flash.h"
+
+STORED_COLORS color = {0};
+uint32_t colorVersion = 0;
+
+// Colors changed in RAM since they were last written to EEPROM
+static uint32_t dirtyBits[COLOR_BITMAP_WORDS] = {0};
+bool autoCommit = true;
+static uint8_t pendingCommits = 0;         // COMMIT_ bits for the persistence task
+static bool migrationPending = false;      // old layout not moved to the journal yet
+COMMIT_STATS commitStats = {0};
+
+int threshold = 0;
+bool validCalibration = false;
+bool calibrateMode = false;
+
+// Function to initialize EEPROM
+void initEeprom(void)
+{
+    SYSCTL_RCGCEEPROM_R = 1;
+    _delay_cycles(6);
+    while (EEPROM_EEDONE_R & EEPROM_EEDONE_WORKING);
+}
+
+// Function to write data to EEPROM
+void writeEeprom(uint16_t add, uint32_t data)
+{
+    EEPROM_EEBLOCK_R = add >> 4; // Shift right 4 bits is same as dividing address by 16
+    EEPROM_EEOFFSET_R = add & 0xF;
+    EEPROM_EERDWR_R = data;
+    COUNT_STAT(STAT_EEPROM_WRITES);
+    while (EEPROM_EEDONE_R & EEPROM_EEDONE_WORKING);
+}
+
+// Function to read data from EEPROM
+uint32_t readEeprom(uint16_t add)
+{
+    EEPROM_EEBLOCK_R = add >> 4;
+    EEPROM_EEOFFSET_R = add & 0xF;
+    return EEPROM_EERDWR_R;
+}
+
+// Function to read consecutive words from EEPROM with the auto-increment register
+void readEepromWords(uint16_t add, uint32_t data[], uint16_t count)
+{
+    uint16_t i;
+
+    for(i = 0; i < count; i++, add++)
+    {
+        // Offset wraps within a block, so select each block as it is entered
+        if(i == 0 || (add & 0xF) == 0)
+        {
+            EEPROM_EEBLOCK_R = add >> 4;
+            EEPROM_EEOFFSET_R = add & 0xF;
+        }
+
+        data[i] = EEPROM_EERDWRINC_R;
+    }
+}
+
+// Function to write consecutive words to EEPROM with the auto-increment register
+void writeEepromWords(uint16_t add, const uint32_t data[], uint16_t count)
+{
+    uint16_t i;
+
+    for(i = 0; i < count; i++, add++)
+    {
+        if(i == 0 || (add & 0xF) == 0)
+        {
+            EEPROM_EEBLOCK_R = add >> 4;
+            EEPROM_EEOFFSET_R = add & 0xF;
+        }
+
+        EEPROM_EERDWRINC_R = data[i];
+        COUNT_STAT(STAT_EEPROM_WRITES);
+        while (EEPROM_EEDONE_R & EEPROM_EEDONE_WORKING);
+    }
+}
+
+// Returns true if color reference index holds a learned color
+bool isColorValid(uint16_t index)
+{
+    return (color.validBits[index >> 5] >> (index & 31)) & 1;
+}
+
+// Returns true if color reference index changed since it was last committed
+bool isColorDirty(uint16_t index)
+{
+    return (dirtyBits[index >> 5] >> (index & 31)) & 1;
+}
+
+// Flag color reference index for the next commit
+static void markColorDirty(uint16_t index)
+{
+    dirtyBits[index >> 5] |= (uint32_t)1 << (index & 31);
+}
+
+// Store color reference index in RAM, mark it valid, move it to the grid
+// cell of its new value and precompute its L*a*b* value. Any class model is
+// cleared, the caller sets a new one with setColorModel().
+void setColor(uint16_t index, uint32_t red, uint32_t green, uint32_t blue)
+{
+    if(isColorValid(index))
+    {
+        removeColorGrid(index);
+    }
+
+    color.rgb[index] = COLOR_RGB(red, green, blue);
+    color.model[index] = 0;
+    color.validBits[index >> 5] |= (uint32_t)1 << (index & 31);
+
+    insertColorGrid(index);
+    updateColorLab(index);
+    markColorDirty(index);
+    colorVersion++;
+}
+
+// Attach a class model to color reference index
+void setColorModel(uint16_t index, uint16_t model)
+{
+    color.model[index] = model;
+    markColorDirty(index);
+    colorVersion++;
+}
+
+// Returns number of learned colors
+uint16_t countColors(void)
+{
+    uint16_t i, count = 0;
+
+    for(i = 0; i < TOTAL_COLORS; i++)
+    {
+        count += isColorValid(i);
+    }
+
+    return count;
+}
+
+// Checksum of the migration page, word added to sum
+static uint32_t migrationSum(uint32_t sum, uint32_t word)
+{
+    return ((sum << 1) | (sum >> 31)) + word;
+}
+
+// Copy the colors in RAM to the migration page, the header written last
+// makes the copy valid. Returns false if the flash could not be written.
+static bool stageColors(void)
+{
+    uint32_t address = MIGRATION_PAGE + MIGRATION_FIRST, sum = 0, word, header;
+    uint16_t i, count = 0;
+    bool ok = eraseFlashPage(MIGRATION_PAGE);
+
+    for(i = 0; ok && i < TOTAL_COLORS; i++)
+    {
+        if(isColorValid(i))
+        {
+            word = ((uint32_t)i << 16) | color.model[i];
+            ok = writeFlashWord(address, word) && writeFlashWord(address + 4, color.rgb[i]);
+            sum = migrationSum(migrationSum(sum, word), color.rgb[i]);
+            address += 8;
+            count++;
+        }
+    }
+
+    header = MIGRATION_MAGIC | count;
+
+    return ok && writeFlashWord(MIGRATION_PAGE + 4, migrationSum(sum, header))
+              && writeFlashWord(MIGRATION_PAGE, header);
+}
+
+// Load the colors of a valid migration page into RAM. Returns false if the
+// page holds no complete copy.
+static bool readStagedColors(void)
+{
+    uint32_t header = readFlashWord(MIGRATION_PAGE), address, sum = 0, word;
+    uint16_t count = header & 0xFFFF, i, index;
+
+    if((header & 0xFFFF0000) != MIGRATION_MAGIC || count > TOTAL_COLORS)
+    {
+        return false;
+    }
+
+    for(i = 0, address = MIGRATION_PAGE + MIGRATION_FIRST; i < count; i++, address += 8)
+    {
+        sum = migrationSum(migrationSum(sum, readFlashWord(address)), readFlashWord(address + 4));
+    }
+
+    if(migrationSum(sum, header) != readFlashWord(MIGRATION_PAGE + 4))
+    {
+        return false;
+    }
+
+    for(i = 0, address = MIGRATION_PAGE + MIGRATION_FIRST; i < count; i++, address += 8)
+    {
+        word = readFlashWord(address);
+        index = word >> 16;
+
+        if(index < TOTAL_COLORS)
+        {
+            color.rgb[index] = readFlashWord(address + 4) & 0xFFFFFF;
+            color.model[index] = word & 0xFFFF;
+            color.validBits[index >> 5] |= (uint32_t)1 << (index & 31);
+        }
+    }
+
+    return true;
+}
+
+// Start the journal with the colors in RAM. Unless they came from the
+// migration page already, they are copied there first: the old layout is
+// only overwritten once the copy is complete, and a restart before the copy
+// is dropped runs the migration again from it. Returns false, writing
+// nothing, if the copy failed.
+static bool migrateColors(bool staged)
+{
+    if(!staged && !stageColors())
+    {
+        sendUart0String("  Colors NOT moved to the journal, flash copy failed.\r\n");
+        migrationPending = true;
+        return false;
+    }
+
+    migrationPending = false;
+
+    formatJournal();
+    storeColors();
+    eraseFlashPage(MIGRATION_PAGE);
+
+    return true;
+}
+
+// Returns true once an old layout has been moved into the journal, a move
+// whose flash copy failed is tried again on every commit
+static bool finishMigration(void)
+{
+    return !migrationPending || migrateColors(false);
+}
+
+// Append a journal record for every dirty color, a learned color's model and
+// RGB word or an erase. Records equal to the stored ones are skipped. Colors
+// that do not fit stay dirty. Returns the number of colors committed.
+// Nothing is written until an old layout has been moved.
+uint16_t commitColors(void)
+{
+    uint16_t word, i, committed = 0;
+    uint32_t start = readCycleCounter(), elapsed;
+    bool stored;
+
+    if(!finishMigration())
+    {
+        return 0;
+    }
+
+    for(word = 0; word < COLOR_BITMAP_WORDS; word++)
+    {
+        if(dirtyBits[word] == 0)
+        {
+            continue;
+        }
+
+        for(i = word << 5; i < (word + 1) << 5; i++)
+        {
+            if(isColorDirty(i))
+            {
+                if(isColorValid(i))
+                {
+                    stored = writeJournal(i, color.model[i], color.rgb[i]);
+                }
+                else
+                {
+                    stored = eraseJournal(i);
+                }
+
+                if(stored)
+                {
+                    dirtyBits[word] &= ~((uint32_t)1 << (i & 31));
+                    committed++;
+                }
+            }
+        }
+    }
+
+    elapsed = readCycleCounter() - start;
+
+    commitStats.commits++;
+    commitStats.lastCycles = elapsed;
+    if(elapsed > commitStats.maxCycles)
+    {
+        commitStats.maxCycles = elapsed;
+    }
+
+    return committed;
+}
+
+// Append journal records for the calibration and the match settings, unless
+// they are unchanged
+void commitSettings(void)
+{
+    if(!finishMigration())
+    {
+        return;
+    }
+
+    // The threshold is 0..4095 once calibrated
+    if(validCalibration)
+    {
+        writeJournal(KEY_CALIBRATION, threshold, rgbLeds[0] | ((uint32_t)rgbLeds[1] << 10) | ((uint32_t)rgbLeds[2] << 20));
+    }
+
+    writeJournal(KEY_SETTINGS,
+                 matchValue | (matchMetric << 8) | (rankFormat << 9) | (stable.mode << 10) | (matchMode << 11),
+                 rankSize | ((uint32_t)stable.window << 8) | ((uint32_t)stable.majority << 16) | ((uint32_t)stable.dwell << 24));
+}
+
+// Have the persistence task write colors and/or settings once the command
+// that changed them returns
+void requestCommit(uint8_t what)
+{
+    pendingCommits |= what;
+    postTask(&scheduler, TASK_PERSIST);
+}
+
+// Persistence task, writes everything requested since it last ran
+void persistTask(void)
+{
+    uint8_t what = pendingCommits;
+
+    pendingCommits = 0;
+
+    if(what & COMMIT_COLORS)
+    {
+        commitColors();
+    }
+
+    if(what & COMMIT_SETTINGS)
+    {
+        commitSettings();
+    }
+}
+
+// Store the whole color library and settings in EEPROM, only records that
+// changed are written
+void storeColors(void)
+{
+    uint16_t i;
+
+    for(i = 0; i < TOTAL_COLORS; i++)
+    {
+        if(isColorValid(i))
+        {
+            markColorDirty(i);
+        }
+    }
+
+    commitColors();
+    commitSettings();
+}
+
+// Apply the latest journal record of a key
+static void loadRecord(uint16_t key, uint16_t first, uint32_t second)
+{
+    if(key < TOTAL_COLORS)
+    {
+        color.rgb[key] = second & 0xFFFFFF;
+        color.model[key] = first;
+        color.validBits[key >> 5] |= (uint32_t)1 << (key & 31);
+    }
+    else if(key == KEY_CALIBRATION)
+    {
+        threshold = first;
+        rgbLeds[0] = second & 0x3FF;
+        rgbLeds[1] = (second >> 10) & 0x3FF;
+        rgbLeds[2] = (second >> 20) & 0x3FF;
+        validCalibration = true;
+    }
+    else if(key == KEY_SETTINGS)
+    {
+        matchValue = first & 0xFF;
+        matchMetric = (first >> 8) & 1;
+        rankFormat = (first >> 9) & 1;
+        stable.mode = (first >> 10) & 1;
+        matchMode = (first >> 11) & 1;
+        rankSize = second & 0xFF;
+        configureStabilizer(&stable, (second >> 8) & 0xFF, (second >> 16) & 0xFF, (second >> 24) & 0xFF);
+    }
+}
+
+// Read one color of the packed layout into color reference index
+static void readPackedColor(uint32_t header, uint16_t packed, uint16_t index)
+{
+    color.rgb[index] = readEeprom(COLOR_RGB_ADDRESS + packed) & 0xFFFFFF;
+    color.model[index] = 0;
+    color.validBits[index >> 5] |= (uint32_t)1 << (index & 31);
+
+    // From version 2 the models follow, two per word
+    if(header == COLOR_HEADER)
+    {
+        color.model[index] = readEeprom(COLOR_MODEL_ADDRESS + (packed >> 1)) >> (16 * (packed & 1));
+    }
+}
+
+// Read a library in the packed layout used before the journal: a header word,
+// a validity bitmap, one RGB word per color and, from version 2, the models.
+// Colors at indexes past TOTAL_COLORS move to the lowest free indexes; if
+// none is left they are displayed so they can be learned again.
+static void readPackedColors(uint32_t header)
+{
+    uint32_t validBits[PACKED_BITMAP_WORDS];
+    uint16_t packed, index = 0;
+
+    readEepromWords(COLOR_BITMAP_ADDRESS, validBits, PACKED_BITMAP_WORDS);
+
+    for(packed = 0; packed < TOTAL_COLORS; packed++)
+    {
+        if((validBits[packed >> 5] >> (packed & 31)) & 1)
+        {
+            readPackedColor(header, packed, packed);
+        }
+    }
+
+    for(packed = TOTAL_COLORS; packed < PACKED_COLORS; packed++)
+    {
+        if(!((validBits[packed >> 5] >> (packed & 31)) & 1))
+        {
+            continue;
+        }
+
+        while(index < TOTAL_COLORS && isColorValid(index))
+        {
+            index++;
+        }
+
+        sendUart0String("  color ");
+        sendUart0Unsigned(packed);
+
+        if(index < TOTAL_COLORS)
+        {
+            readPackedColor(header, packed, index);
+            sendUart0String(" is now color ");
+            sendUart0Unsigned(index);
+            sendUart0String(".\r\n");
+        }
+        else
+        {
+            sendUart0String(" NOT kept, no free index: ");
+            sendUart0Triplet(COLOR_RED(readEeprom(COLOR_RGB_ADDRESS + packed)),
+                             COLOR_GREEN(readEeprom(COLOR_RGB_ADDRESS + packed)),
+                             COLOR_BLUE(readEeprom(COLOR_RGB_ADDRESS + packed)));
+            sendUart0String("\r\n");
+        }
+    }
+}
+
+// Read colors stored one per 16 word block, with a valid flag of 1 followed
+// by red, green and blue words
+static void readLegacyColors(void)
+{
+    uint16_t i;
+    uint32_t legacy[4];
+
+    for(i = 0; i < LEGACY_COLORS; i++)
+    {
+        readEepromWords(EEPROM_BLOCK_WORDS * i, legacy, 4);
+
+        if(legacy[0] == 1)
+        {
+            color.rgb[i] = COLOR_RGB(legacy[1] & 0xFF, legacy[2] & 0xFF, legacy[3] & 0xFF);
+            color.validBits[i >> 5] |= (uint32_t)1 << (i & 31);
+        }
+    }
+}
+
+// Load colors, calibration and settings from the EEPROM journal. Without a
+// journal an older layout is read into RAM and the journal is started with
+// it.
+void loadColors(void)
+{
+    uint16_t i;
+    uint32_t header;
+
+    memset(&color, 0, sizeof(color));
+    memset(dirtyBits, 0, sizeof(dirtyBits));
+    colorVersion++;
+
+    if(readStagedColors())
+    {
+        // The last migration was cut short, the journal may be partly written
+        migrateColors(true);
+    }
+    else if(!mountJournal(loadRecord))
+    {
+        header = readEeprom(COLOR_HEADER_ADDRESS);
+
+        if((header & 0xFFFF0000) == COLOR_MAGIC && header <= COLOR_HEADER)
+        {
+            readPackedColors(header);
+        }
+        else
+        {
+            readLegacyColors();
+        }
+
+        migrateColors(false);
+    }
+
+    buildColorGrid();
+
+    for(i = 0; i < TOTAL_COLORS; i++)
+    {
+        if(isColorValid(i))
+        {
+            updateColorLab(i);
+        }
+    }
+}
+
+// Erase color specified by user, the journal records the erase
+void eraseColor(int index)
+{
+    if(isColorValid(index))
+    {
+        removeColorGrid(index);
+    }
+
+    color.validBits[index >> 5] &= ~((uint32_t)1 << (index & 31));
+    markColorDirty(index);
+    colorVersion++;
+
+    if(autoCommit)
+    {
+        requestCommit(COMMIT_COLORS);
+    }
+}
+
+
+// Displays all colors learned by device for user
+void printLearnedColors(void)
+{
+    uint16_t i;
+    bool none = true;
+
+    for(i = 0; i < TOTAL_COLORS; i++)
+    {
+        if(isColorValid(i))
+        {
+            sendUart0String("  color ");
+            sendUart0Unsigned(i);
+            sendUart0String(": ");
+            sendUart0Triplet(COLOR_RED(color.rgb[i]), COLOR_GREEN(color.rgb[i]), COLOR_BLUE(color.rgb[i]));
+
+            // Standard deviations are held in units of 1/2
+            if(color.model[i] & MODEL_VALID)
+            {
+                sendUart0String(" sd ");
+                sendUart0Fixed(5 * MODEL_SIGMA(color.model[i], 0), 1);
+                sendUart0String(",");
+                sendUart0Fixed(5 * MODEL_SIGMA(color.model[i], 1), 1);
+                sendUart0String(",");
+                sendUart0Fixed(5 * MODEL_SIGMA(color.model[i], 2), 1);
+            }
+            sendUart0String("\r\n");
+
+            none = false;
+        }
+    }
+
+    if(none)
+    {
+        sendUart0String("  NO colors learned.\r\n");
+    }
+}
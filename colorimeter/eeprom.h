@@ -1,50 +1,118 @@
-// eeprom.h
-// William Bozarth
-// Created on: October 7, 2020
-
-//-----------------------------------------------------------------------------
-// Hardware Target
-//-----------------------------------------------------------------------------
-
-// Target Platform: EK-TM4C123GXL Evaluation Board
-// Target uC:       TM4C123GH6PM
-// System Clock:    40 MHz
-
-#ifndef EEPROM_H_
-#define EEPROM_H_
-
-//
-// Includes and Defines
-//
-#include <stdint.h>
-#include <stdbool.h>
-#include "eeprom.h"
-
-#define TOTAL_COLORS 16
-
-typedef struct _STORED_COLORS {
-    //--- color N and erase N Variables -----
-    uint8_t index;
-    bool validBit[TOTAL_COLORS];
-    uint32_t redValue[TOTAL_COLORS];
-    uint32_t greenValue[TOTAL_COLORS];
-    uint32_t blueValue[TOTAL_COLORS];
-} STORED_COLORS;
-
-extern STORED_COLORS color;
-
-//----- Calibrate Variables ------------
-extern int threshold;
-extern bool validCalibration;
-extern bool calibrateMode;
-
-void initEeprom(void);
-void writeEeprom(uint16_t add, uint32_t data);
-uint32_t readEeprom(uint16_t add);
-void readEepromAddress(void);
-void storeColors(void);
-void loadColors(void);
-void eraseColor(int index);
-void printLearnedColors(void);
-
-#endif /* EEPROM_H_ */
+// eeprom.h
+// William Bozarth
+// Created on: October 7, 2020
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#ifndef EEPROM_H_
+#define EEPROM_H_
+
+//
+// Includes and Defines
+//
+#include <stdint.h>
+#include <stdbool.h>
+#include "eeprom.h"
+
+// Every color reference must fit in the journal at once. A color takes a two
+// word record, 7 to a block, and 3 of the 26 journal blocks are kept for
+// wear leveling (see journal.h), which leaves room for 159 colors next to
+// the calibration and settings. 256 colors would need all 512 words of the
+// EEPROM. The host tests build the color index for other library sizes.
+#ifndef TOTAL_COLORS
+#define TOTAL_COLORS 128
+#endif
+#define COLOR_BITMAP_WORDS ((TOTAL_COLORS + 31) / 32)
+
+// EEPROM map, in 16 word blocks: the journal holding colors, calibration and
+// settings in blocks 0..25 (see journal.h), macros in the last MAX_MACROS blocks
+#define EEPROM_BLOCK_WORDS 16
+#define MACRO_BLOCK        26
+#define MAX_MACROS         6
+
+// Packed color library used before the journal, read once to migrate it: a
+// header word, a validity bitmap with one bit per color, one 0x00RRGGBB word
+// per color, then the class models two per word. It had 256 indexes.
+#define COLOR_MAGIC          0xC01B0000     // magic number, layout version in low bits
+#define COLOR_VERSION        2
+#define COLOR_HEADER         (COLOR_MAGIC | COLOR_VERSION)
+#define PACKED_COLORS        256
+#define PACKED_BITMAP_WORDS  (PACKED_COLORS / 32)
+#define COLOR_HEADER_ADDRESS 0
+#define COLOR_BITMAP_ADDRESS (COLOR_HEADER_ADDRESS + 1)
+#define COLOR_RGB_ADDRESS    (COLOR_BITMAP_ADDRESS + PACKED_BITMAP_WORDS)
+#define COLOR_MODEL_ADDRESS  (COLOR_RGB_ADDRESS + PACKED_COLORS)
+#define LEGACY_COLORS        16             // colors in the original 16 word per color layout
+
+// Colors moved into the journal are first copied to a flash page set in
+// tm4c123gh6pm.cmd, so a power cut during the move restarts it from the copy:
+// a header word MIGRATION_MAGIC | count, a checksum word, then per color a
+// word with the index in bits 31..16 and the model, and its RGB word. The
+// header is written last.
+extern uint8_t __MIGRATION_PAGE[];
+#define MIGRATION_PAGE       ((uint32_t)__MIGRATION_PAGE)
+#define MIGRATION_MAGIC      0x4D470000
+#define MIGRATION_FIRST      8              // byte offset of the first color
+
+// What requestCommit() asks the persistence task to write
+#define COMMIT_COLORS        1
+#define COMMIT_SETTINGS      2
+
+#define COLOR_RGB(red, green, blue) (((uint32_t)(red) << 16) | ((uint32_t)(green) << 8) | (uint32_t)(blue))
+#define COLOR_RED(rgb)              (((rgb) >> 16) & 0xFF)
+#define COLOR_GREEN(rgb)            (((rgb) >> 8) & 0xFF)
+#define COLOR_BLUE(rgb)             ((rgb) & 0xFF)
+
+typedef struct _STORED_COLORS {
+    //--- color N and erase N Variables -----
+    uint16_t index;
+    uint32_t validBits[COLOR_BITMAP_WORDS];
+    uint32_t rgb[TOTAL_COLORS];
+    uint16_t model[TOTAL_COLORS];           // see model.h, 0 for a single sample reference
+} STORED_COLORS;
+
+extern STORED_COLORS color;
+
+// Cost of committing changes to EEPROM, cycles are core clock cycles
+typedef struct _COMMIT_STATS {
+    uint32_t commits;
+    uint32_t lastCycles;
+    uint32_t maxCycles;
+} COMMIT_STATS;
+
+extern bool autoCommit;                     // commit each color and erase as it happens
+extern COMMIT_STATS commitStats;
+extern uint32_t colorVersion;           // bumped on every change to the library
+
+//----- Calibrate Variables ------------
+extern int threshold;
+extern bool validCalibration;
+extern bool calibrateMode;
+
+void initEeprom(void);
+void writeEeprom(uint16_t add, uint32_t data);
+uint32_t readEeprom(uint16_t add);
+void readEepromWords(uint16_t add, uint32_t data[], uint16_t count);
+void writeEepromWords(uint16_t add, const uint32_t data[], uint16_t count);
+void readEepromAddress(void);
+bool isColorValid(uint16_t index);
+bool isColorDirty(uint16_t index);
+void setColor(uint16_t index, uint32_t red, uint32_t green, uint32_t blue);
+void setColorModel(uint16_t index, uint16_t model);
+uint16_t countColors(void);
+uint16_t commitColors(void);
+void commitSettings(void);
+void requestCommit(uint8_t what);
+void persistTask(void);
+void storeColors(void);
+void loadColors(void);
+void eraseColor(int index);
+void printLearnedColors(void);
+
+#endif /* EEPROM_H_ */
@@ -0,0 +1,59 @@
+// flash.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+// Program and erase of the on-chip flash through the flash memory controller.
+// The CPU stalls on flash reads while an operation runs, so each call blocks
+// until it completes: about 30 us for a word and up to 15 ms for a page.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "tm4c123gh6pm.h"
+#include "flash.h"
+
+// Returns the key the controller expects with a write or erase command
+static uint32_t flashKey(void)
+{
+    return (FLASH_BOOTCFG_R & FLASH_BOOTCFG_KEY) ? FLASH_FMC_WRKEY : FLASH_FMC_WRKEY_ALT;
+}
+
+// Start a command and wait for it to finish, returns false if the address
+// was protected or out of range
+static bool runFlashCommand(uint32_t address, uint32_t command)
+{
+    FLASH_FCMISC_R = FLASH_FCMISC_AMISC;
+    FLASH_FMA_R = address;
+    FLASH_FMC_R = flashKey() | command;
+
+    while(FLASH_FMC_R & command);
+
+    return !(FLASH_FCRIS_R & FLASH_FCRIS_ARIS);
+}
+
+// Erase the page holding address, every word reads FLASH_ERASED afterwards
+bool eraseFlashPage(uint32_t address)
+{
+    return runFlashCommand(address & ~(FLASH_PAGE_SIZE - 1), FLASH_FMC_ERASE);
+}
+
+// Program one word, which must be erased since a write can only clear bits
+bool writeFlashWord(uint32_t address, uint32_t data)
+{
+    FLASH_FMD_R = data;
+
+    return runFlashCommand(address, FLASH_FMC_WRITE);
+}
+
+// Read one word straight from the memory map
+uint32_t readFlashWord(uint32_t address)
+{
+    return *((volatile uint32_t *)address);
+}
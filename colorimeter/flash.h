@@ -0,0 +1,33 @@
+// flash.h
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#ifndef FLASH_H_
+#define FLASH_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//
+// Defines
+//
+#define FLASH_PAGE_SIZE      1024                // bytes cleared by one erase
+#define FLASH_ERASED         0xFFFFFFFF
+#define FLASH_FMC_WRKEY_ALT  0x71D50000          // write key when BOOTCFG KEY is clear
+
+//
+// Definitions
+//
+bool eraseFlashPage(uint32_t address);
+bool writeFlashWord(uint32_t address, uint32_t data);
+uint32_t readFlashWord(uint32_t address);
+
+#endif /* FLASH_H_ */
@@ -0,0 +1,186 @@
+// format.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+// Small replacements for snprintf() on the output paths, so the printf engine
+// is not needed to print numbers
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "uart0.h"
+#include "format.h"
+
+// Format value in decimal
+uint8_t formatUnsigned(char str[], uint32_t value)
+{
+    uint8_t i, length = 1;
+    uint32_t temp = value;
+
+    // Count digits so string can be filled from the right
+    while(temp >= 10)
+    {
+        temp /= 10;
+        length++;
+    }
+
+    str[length] = '\0';
+
+    for(i = length; i > 0; i--)
+    {
+        str[i - 1] = '0' + (value % 10);
+        value /= 10;
+    }
+
+    return length;
+}
+
+// Format value in decimal with a leading '-' if negative
+uint8_t formatSigned(char str[], int32_t value)
+{
+    if(value < 0)
+    {
+        str[0] = '-';
+        return formatUnsigned(&str[1], -(uint32_t)value) + 1;
+    }
+
+    return formatUnsigned(str, value);
+}
+
+// Format value in lower case hex, zero padded to at least digits characters
+uint8_t formatHex(char str[], uint32_t value, uint8_t digits)
+{
+    uint8_t i, length = 1;
+    uint32_t temp = value;
+    const char hex[] = "0123456789abcdef";
+
+    while(temp >= 16)
+    {
+        temp >>= 4;
+        length++;
+    }
+
+    if(length < digits)
+    {
+        length = digits;
+    }
+
+    str[length] = '\0';
+
+    for(i = length; i > 0; i--)
+    {
+        str[i - 1] = hex[value & 0xF];
+        value >>= 4;
+    }
+
+    return length;
+}
+
+// Format a fixed point value given in units of 10^-decimals, e.g. 1500 with
+// 3 decimals is "1.500"
+uint8_t formatFixed(char str[], int32_t value, uint8_t decimals)
+{
+    uint8_t i, length = 0;
+    uint32_t magnitude, scale = 1;
+
+    for(i = 0; i < decimals; i++)
+    {
+        scale *= 10;
+    }
+
+    if(value < 0)
+    {
+        str[length++] = '-';
+        magnitude = -(uint32_t)value;
+    }
+    else
+    {
+        magnitude = value;
+    }
+
+    length += formatUnsigned(&str[length], magnitude / scale);
+
+    if(decimals > 0)
+    {
+        magnitude %= scale;
+        str[length++] = '.';
+
+        // Write fraction zero padded from the right
+        for(i = decimals; i > 0; i--)
+        {
+            str[length + i - 1] = '0' + (magnitude % 10);
+            magnitude /= 10;
+        }
+
+        length += decimals;
+        str[length] = '\0';
+    }
+
+    return length;
+}
+
+// Format three values as comma separated values, e.g. "12,34,56"
+uint8_t formatTriplet(char str[], uint32_t first, uint32_t second, uint32_t third)
+{
+    uint8_t length;
+
+    length = formatUnsigned(str, first);
+    str[length++] = ',';
+    length += formatUnsigned(&str[length], second);
+    str[length++] = ',';
+    length += formatUnsigned(&str[length], third);
+
+    return length;
+}
+
+// Send value in decimal
+void sendUart0Unsigned(uint32_t value)
+{
+    char str[FORMAT_NUMBER_LENGTH];
+
+    formatUnsigned(str, value);
+    sendUart0String(str);
+}
+
+// Send value in decimal with a leading '-' if negative
+void sendUart0Signed(int32_t value)
+{
+    char str[FORMAT_NUMBER_LENGTH];
+
+    formatSigned(str, value);
+    sendUart0String(str);
+}
+
+// Send value in hex, zero padded to at least digits characters
+void sendUart0Hex(uint32_t value, uint8_t digits)
+{
+    char str[FORMAT_NUMBER_LENGTH];
+
+    formatHex(str, value, digits);
+    sendUart0String(str);
+}
+
+// Send a fixed point value given in units of 10^-decimals
+void sendUart0Fixed(int32_t value, uint8_t decimals)
+{
+    char str[FORMAT_NUMBER_LENGTH + 1];
+
+    formatFixed(str, value, decimals);
+    sendUart0String(str);
+}
+
+// Send three values as comma separated values
+void sendUart0Triplet(uint32_t first, uint32_t second, uint32_t third)
+{
+    char str[FORMAT_TRIPLET_LENGTH];
+
+    formatTriplet(str, first, second, third);
+    sendUart0String(str);
+}
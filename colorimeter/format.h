@@ -0,0 +1,43 @@
+// format.h
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#ifndef FORMAT_H_
+#define FORMAT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//
+// Defines
+//
+#define FORMAT_NUMBER_LENGTH  12                                // "-2147483648" plus NULL
+#define FORMAT_TRIPLET_LENGTH (3 * FORMAT_NUMBER_LENGTH)
+
+//
+// Definitions
+//
+
+// Each function writes a NULL terminated string to str and returns its length
+uint8_t formatUnsigned(char str[], uint32_t value);
+uint8_t formatSigned(char str[], int32_t value);
+uint8_t formatHex(char str[], uint32_t value, uint8_t digits);
+uint8_t formatFixed(char str[], int32_t value, uint8_t decimals);
+uint8_t formatTriplet(char str[], uint32_t first, uint32_t second, uint32_t third);
+
+// Each function formats a value straight into the UART0 Tx ring buffer
+void sendUart0Unsigned(uint32_t value);
+void sendUart0Signed(int32_t value);
+void sendUart0Hex(uint32_t value, uint8_t digits);
+void sendUart0Fixed(int32_t value, uint8_t decimals);
+void sendUart0Triplet(uint32_t first, uint32_t second, uint32_t third);
+
+#endif /* FORMAT_H_ */
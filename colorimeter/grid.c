@@ -0,0 +1,210 @@
+// grid.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+// Spatial index of the color library. Colors are bucketed by the top
+// GRID_BITS of each channel, so a query only visits cells near the sample
+// instead of every learned color. The index lives in two static arrays and is
+// updated in place whenever a color is learned or erased.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "eeprom.h"
+#include "grid.h"
+
+static uint16_t cellHead[GRID_CELLS];
+static uint16_t nextColor[TOTAL_COLORS];
+
+// Returns cell number from cell coordinates
+static uint16_t gridCell(uint8_t x, uint8_t y, uint8_t z)
+{
+    return ((uint16_t)x << (2 * GRID_BITS)) | ((uint16_t)y << GRID_BITS) | z;
+}
+
+// Returns cell holding a packed color
+static uint16_t colorCell(uint32_t rgb)
+{
+    return gridCell(COLOR_RED(rgb) >> GRID_SHIFT, COLOR_GREEN(rgb) >> GRID_SHIFT, COLOR_BLUE(rgb) >> GRID_SHIFT);
+}
+
+// Returns squared Euclidean distance between a packed color and a sample
+static uint32_t colorDistance(uint32_t rgb, uint8_t red, uint8_t green, uint8_t blue)
+{
+    int32_t dr = (int32_t)COLOR_RED(rgb) - red;
+    int32_t dg = (int32_t)COLOR_GREEN(rgb) - green;
+    int32_t db = (int32_t)COLOR_BLUE(rgb) - blue;
+
+    return (dr * dr) + (dg * dg) + (db * db);
+}
+
+// Rebuild the grid from every valid color
+void buildColorGrid(void)
+{
+    uint16_t i;
+
+    for(i = 0; i < GRID_CELLS; i++)
+    {
+        cellHead[i] = NO_COLOR;
+    }
+
+    for(i = 0; i < TOTAL_COLORS; i++)
+    {
+        if(isColorValid(i))
+        {
+            insertColorGrid(i);
+        }
+    }
+}
+
+// Add color to the cell matching its current value
+void insertColorGrid(uint16_t index)
+{
+    uint16_t cell = colorCell(color.rgb[index]);
+
+    nextColor[index] = cellHead[cell];
+    cellHead[cell] = index;
+}
+
+// Remove color from the cell matching its current value, call before the
+// value changes
+void removeColorGrid(uint16_t index)
+{
+    uint16_t* link = &cellHead[colorCell(color.rgb[index])];
+
+    while(*link != NO_COLOR)
+    {
+        if(*link == index)
+        {
+            *link = nextColor[index];
+            return;
+        }
+
+        link = &nextColor[*link];
+    }
+}
+
+// Returns learned color closest to the sample, or NO_COLOR if none are
+// learned. Searches shells of cells around the sample's cell until no
+// unsearched cell can hold a closer color.
+uint16_t findNearestColor(uint8_t red, uint8_t green, uint8_t blue, uint32_t* distanceSquared)
+{
+    const uint8_t sample[3] = {red, green, blue};
+    int8_t center[3], low[3], high[3], x, y, z;
+    int16_t gap, edge;
+    uint8_t shell, axis;
+    uint16_t i, best = NO_COLOR;
+    uint32_t distance, bestDistance = 0xFFFFFFFF;
+
+    for(axis = 0; axis < 3; axis++)
+    {
+        center[axis] = sample[axis] >> GRID_SHIFT;
+    }
+
+    for(shell = 0; shell < GRID_SIZE; shell++)
+    {
+        for(axis = 0; axis < 3; axis++)
+        {
+            low[axis] = (center[axis] - shell < 0) ? 0 : center[axis] - shell;
+            high[axis] = (center[axis] + shell >= GRID_SIZE) ? GRID_SIZE - 1 : center[axis] + shell;
+        }
+
+        // Visit only the cells on the surface of this shell
+        for(x = low[0]; x <= high[0]; x++)
+        {
+            for(y = low[1]; y <= high[1]; y++)
+            {
+                for(z = low[2]; z <= high[2]; z++)
+                {
+                    if(x != center[0] - shell && x != center[0] + shell &&
+                       y != center[1] - shell && y != center[1] + shell &&
+                       z != center[2] - shell && z != center[2] + shell)
+                    {
+                        continue;
+                    }
+
+                    for(i = cellHead[gridCell(x, y, z)]; i != NO_COLOR; i = nextColor[i])
+                    {
+                        distance = colorDistance(color.rgb[i], red, green, blue);
+
+                        if(distance < bestDistance)
+                        {
+                            bestDistance = distance;
+                            best = i;
+                        }
+                    }
+                }
+            }
+        }
+
+        // Closest a color outside the searched box can be to the sample
+        gap = 0x7FFF;
+        for(axis = 0; axis < 3; axis++)
+        {
+            if(low[axis] > 0)
+            {
+                edge = sample[axis] - (low[axis] << GRID_SHIFT) + 1;
+                gap = (edge < gap) ? edge : gap;
+            }
+            if(high[axis] < GRID_SIZE - 1)
+            {
+                edge = ((high[axis] + 1) << GRID_SHIFT) - sample[axis];
+                gap = (edge < gap) ? edge : gap;
+            }
+        }
+
+        if(gap == 0x7FFF || (best != NO_COLOR && bestDistance <= (uint32_t)(gap * gap)))
+        {
+            break;
+        }
+    }
+
+    *distanceSquared = bestDistance;
+
+    return best;
+}
+
+// Call visitor for every learned color closer than e to the sample, visiting
+// only cells that overlap the cube of side 2e around it. Returns number found.
+uint16_t findColorsWithin(uint8_t red, uint8_t green, uint8_t blue, uint16_t e, GRID_VISITOR visitor)
+{
+    const uint8_t sample[3] = {red, green, blue};
+    uint8_t low[3], high[3], x, y, z, axis;
+    uint16_t i, count = 0;
+    uint32_t distance, limit = (uint32_t)e * e;
+
+    for(axis = 0; axis < 3; axis++)
+    {
+        low[axis] = (sample[axis] < e) ? 0 : (sample[axis] - e) >> GRID_SHIFT;
+        high[axis] = (sample[axis] + e > 255) ? GRID_SIZE - 1 : (sample[axis] + e) >> GRID_SHIFT;
+    }
+
+    for(x = low[0]; x <= high[0]; x++)
+    {
+        for(y = low[1]; y <= high[1]; y++)
+        {
+            for(z = low[2]; z <= high[2]; z++)
+            {
+                for(i = cellHead[gridCell(x, y, z)]; i != NO_COLOR; i = nextColor[i])
+                {
+                    distance = colorDistance(color.rgb[i], red, green, blue);
+
+                    if(distance < limit)
+                    {
+                        visitor(i, distance);
+                        count++;
+                    }
+                }
+            }
+        }
+    }
+
+    return count;
+}
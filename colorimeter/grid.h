@@ -0,0 +1,42 @@
+// grid.h
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#ifndef GRID_H_
+#define GRID_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//
+// Defines
+//
+
+// Uniform grid over the 8-bit RGB cube, GRID_SIZE cells per axis, each cell
+// holding a linked list of the learned colors that fall inside it
+#define GRID_BITS  3
+#define GRID_SIZE  (1 << GRID_BITS)
+#define GRID_SHIFT (8 - GRID_BITS)
+#define GRID_CELLS (GRID_SIZE * GRID_SIZE * GRID_SIZE)
+#define NO_COLOR   0xFFFF
+
+typedef void (*GRID_VISITOR)(uint16_t index, uint32_t distanceSquared);
+
+//
+// Definitions
+//
+void buildColorGrid(void);
+void insertColorGrid(uint16_t index);
+void removeColorGrid(uint16_t index);
+uint16_t findNearestColor(uint8_t red, uint8_t green, uint8_t blue, uint32_t* distanceSquared);
+uint16_t findColorsWithin(uint8_t red, uint8_t green, uint8_t blue, uint16_t e, GRID_VISITOR visitor);
+
+#endif /* GRID_H_ */
@@ -0,0 +1,206 @@
+// interrupts.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+// NVIC priority plan and the deferred work queue run by PendSV (see
+// interrupts.h). PendSV has the lowest priority, so it runs once every other
+// ISR has returned and is itself preempted by all of them.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "tm4c123gh6pm.h"
+#include "uart0.h"
+#include "format.h"
+#include "cycles.h"
+#include "interrupts.h"
+
+// Priority byte of a peripheral interrupt, IRQ n is byte n from NVIC_PRI0_R
+#define NVIC_PRI_BYTE(irq) (*((volatile uint8_t *)&NVIC_PRI0_R + (irq)))
+
+DEFER_QUEUE deferQueue = {0};
+INTERRUPT_STATS interruptStats = {0};
+
+// Set the priority of the peripheral interrupt with vector number vector
+static void setInterruptPriority(uint8_t vector, uint8_t priority)
+{
+    NVIC_PRI_BYTE(vector - 16) = priority << PRIORITY_SHIFT;
+}
+
+// Apply the priority plan, before any of these interrupts are enabled
+void initInterrupts(void)
+{
+    setInterruptPriority(INT_ADC0SS3, PRIORITY_ADC0);
+    setInterruptPriority(INT_UART0, PRIORITY_UART0);
+    setInterruptPriority(INT_TIMER1A, PRIORITY_TIMER1);
+    setInterruptPriority(INT_TIMER2A, PRIORITY_TIMER2);
+    setInterruptPriority(INT_GPIOF, PRIORITY_GPIOF);
+    setInterruptPriority(INT_WTIMER0A, PRIORITY_WTIMER0);
+
+    NVIC_SYS_PRI3_R = (NVIC_SYS_PRI3_R & ~(NVIC_SYS_PRI3_PENDSV_M | NVIC_SYS_PRI3_TICK_M))
+                    | (PRIORITY_PENDSV << NVIC_SYS_PRI3_PENDSV_S)
+                    | (PRIORITY_SYSTICK << NVIC_SYS_PRI3_TICK_S);
+}
+
+// Mask every interrupt of priority at or below priority (a number at or
+// above it), returns the previous mask for unmaskInterrupts(). A stricter
+// mask already in place is kept.
+uint32_t maskInterrupts(uint8_t priority)
+{
+    uint32_t mask = priority << PRIORITY_SHIFT;
+    uint32_t state = _set_interrupt_priority(mask);
+
+    if(state != 0 && state < mask)
+    {
+        _set_interrupt_priority(state);
+    }
+
+    return state;
+}
+
+void unmaskInterrupts(uint32_t state)
+{
+    _set_interrupt_priority(state);
+}
+
+// Queue work posted at cycle now, returns false if the queue is full.
+// Work already waiting is not queued again.
+bool postWork(DEFER_QUEUE* queue, DEFERRED_WORK work, uint32_t now)
+{
+    uint8_t i, tail;
+
+    for(i = 0; i < queue->count; i++)
+    {
+        if(queue->work[(queue->head + i) % MAX_DEFERRED] == work)
+        {
+            queue->coalesced++;
+            return true;
+        }
+    }
+
+    if(queue->count == MAX_DEFERRED)
+    {
+        queue->dropped++;
+        return false;
+    }
+
+    tail = (queue->head + queue->count) % MAX_DEFERRED;
+    queue->work[tail] = work;
+    queue->posted[tail] = now;
+    queue->count++;
+
+    if(queue->count > queue->maxCount)
+    {
+        queue->maxCount = queue->count;
+    }
+
+    return true;
+}
+
+// Remove the oldest work, returns false if the queue is empty
+bool takeWork(DEFER_QUEUE* queue, DEFERRED_WORK* work, uint32_t* posted)
+{
+    if(queue->count == 0)
+    {
+        return false;
+    }
+
+    *work = queue->work[queue->head];
+    *posted = queue->posted[queue->head];
+    queue->head = (queue->head + 1) % MAX_DEFERRED;
+    queue->count--;
+    queue->runs++;
+
+    return true;
+}
+
+// Post work from any context and request PendSV to run it
+bool deferWork(DEFERRED_WORK work)
+{
+    uint32_t state = _disable_interrupts();
+    bool ok = postWork(&deferQueue, work, readCycleCounter());
+
+    _restore_interrupts(state);
+
+    NVIC_INT_CTRL_R = NVIC_INT_CTRL_PEND_SV;
+
+    return ok;
+}
+
+// Keep the larger of a worst case and a new measurement
+void recordLatency(uint32_t* worst, uint32_t cycles)
+{
+    if(cycles > *worst)
+    {
+        *worst = cycles;
+    }
+}
+
+// Run deferred work until the queue is empty. Work posted while an item
+// runs is picked up by the same pass.
+void pendSvIsr(void)
+{
+    DEFERRED_WORK work;
+    uint32_t posted, start, state;
+    bool found;
+
+    do
+    {
+        state = _disable_interrupts();
+        found = takeWork(&deferQueue, &work, &posted);
+        _restore_interrupts(state);
+
+        if(found)
+        {
+            start = readCycleCounter();
+            recordLatency(&interruptStats.deferLatency, start - posted);
+
+            work();
+
+            recordLatency(&interruptStats.deferCycles, readCycleCounter() - start);
+        }
+    }
+    while(found);
+}
+
+// Print a cycle count in us, with two decimals while they fit
+static void sendUart0Cycles(uint32_t cycles)
+{
+    if(cycles <= (0xFFFFFFFF / 100))
+    {
+        sendUart0Fixed((cycles * 100) / CYCLES_PER_MICROSECOND, 2);
+    }
+    else
+    {
+        sendUart0Unsigned(cyclesToMicroseconds(cycles));
+    }
+
+    sendUart0String(" us");
+}
+
+// Print the worst latencies and the deferred work counters
+void printInterrupts(void)
+{
+    sendUart0String("  timer latency ");
+    sendUart0Cycles(interruptStats.timerLatency);
+    sendUart0String(", deferred latency ");
+    sendUart0Cycles(interruptStats.deferLatency);
+    sendUart0String(", longest deferred work ");
+    sendUart0Cycles(interruptStats.deferCycles);
+    sendUart0String("\r\n  ");
+    sendUart0Unsigned(deferQueue.runs);
+    sendUart0String(" deferred runs, ");
+    sendUart0Unsigned(deferQueue.coalesced);
+    sendUart0String(" coalesced, ");
+    sendUart0Unsigned(deferQueue.dropped);
+    sendUart0String(" dropped, deepest queue ");
+    sendUart0Unsigned(deferQueue.maxCount);
+    sendUart0String("\r\n");
+}
@@ -0,0 +1,81 @@
+// interrupts.h
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#ifndef INTERRUPTS_H_
+#define INTERRUPTS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//
+// Defines
+//
+
+// Priority plan, 0 is the most urgent of the 8 levels. ISRs above PendSV only
+// stamp, move data and post work; anything long runs as deferred work in
+// PendSV, which still preempts the shell in the main loop.
+#define PRIORITY_ADC0      0                     // sensor conversions, polled for now
+#define PRIORITY_UART0     1                     // drains Tx output during a sample
+#define PRIORITY_TIMER1    2                     // sampling deadlines
+#define PRIORITY_TIMER2    2                     // alarms, the settle steps of a sample
+#define PRIORITY_SYSTICK   3
+#define PRIORITY_WTIMER0   3                     // wraps of the us timestamp
+#define PRIORITY_GPIOF     4                     // push button
+#define PRIORITY_PENDSV    7                     // deferred work
+
+#define PRIORITY_SHIFT     5                     // the TM4C123 implements the top 3 bits
+#define MAX_DEFERRED       8
+
+typedef void (*DEFERRED_WORK)(void);
+
+// Work posted from ISRs and run in order by PendSV. Posting work that is
+// already queued is coalesced, so a slow item is never queued twice.
+typedef struct _DEFER_QUEUE
+{
+    DEFERRED_WORK work[MAX_DEFERRED];
+    uint32_t      posted[MAX_DEFERRED];          // cycles when each item was posted
+    uint8_t       head;
+    uint8_t       count;
+    uint8_t       maxCount;
+    uint32_t      runs;
+    uint32_t      coalesced;
+    uint32_t      dropped;
+} DEFER_QUEUE;
+
+// Worst cases since boot, in cycles
+typedef struct _INTERRUPT_STATS
+{
+    uint32_t timerLatency;                      // Timer1 timeout to its ISR
+    uint32_t deferLatency;                      // post to the start of the work
+    uint32_t deferCycles;                       // longest item of deferred work
+} INTERRUPT_STATS;
+
+//
+// Global Variables
+//
+extern DEFER_QUEUE deferQueue;
+extern INTERRUPT_STATS interruptStats;
+
+//
+// Definitions
+//
+void initInterrupts(void);
+uint32_t maskInterrupts(uint8_t priority);
+void unmaskInterrupts(uint32_t state);
+bool postWork(DEFER_QUEUE* queue, DEFERRED_WORK work, uint32_t now);
+bool takeWork(DEFER_QUEUE* queue, DEFERRED_WORK* work, uint32_t* posted);
+bool deferWork(DEFERRED_WORK work);
+void pendSvIsr(void);
+void recordLatency(uint32_t* worst, uint32_t cycles);
+void printInterrupts(void);
+
+#endif /* INTERRUPTS_H_ */
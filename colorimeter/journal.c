@@ -0,0 +1,516 @@
+// journal.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+// Log-structured key/value store over the EEPROM blocks below the macros.
+// Records are only ever appended, so every block is rewritten in turn instead
+// of the same words over and over. When the ring fills up the oldest block is
+// reclaimed by copying its still current records to the newest block.
+//
+// Power-fail safety comes from the write order: a record's data word is
+// written before its key word, a reused block is cleared before its header
+// marks it part of the journal, and a reclaimed block's header is only
+// cleared once its records have been copied. Records and headers carry a CRC,
+// so a word that was cut short is ignored when the journal is mounted.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "eeprom.h"
+#include "uart0.h"
+#include "format.h"
+#include "cycles.h"
+#include "journal.h"
+
+// Sequence numbers wrap, blocks in use are never more than JOURNAL_BLOCKS
+// apart so they are compared with serial number arithmetic
+#define NO_LOCATION     0xFFFF
+#define SEQUENCE_MASK   0xFFFFF
+#define SEQUENCE_HALF   0x80000
+#define KEY_MASK        0xFF
+#define KEY_SHIFT       23
+#define CRC_SHIFT       16
+
+JOURNAL_STATS journalStats = {0};
+
+// Latest record of each key as block * JOURNAL_SLOTS + slot
+static uint16_t location[JOURNAL_KEYS];
+static uint16_t latest = 0;                     // keys with a record, erased keys included
+static uint16_t erased = 0;                     // keys whose latest record is an erase
+
+static uint8_t  head = 0;                       // block records are appended to
+static uint8_t  headSlot = 0;
+static uint8_t  span = 0;                       // blocks in use, oldest to head
+static uint32_t sequence = 0;                   // sequence number of head
+
+// Returns EEPROM address of first word of journal block
+static uint16_t blockAddress(uint8_t block)
+{
+    return (JOURNAL_FIRST_BLOCK + block) * EEPROM_BLOCK_WORDS;
+}
+
+// Returns EEPROM address of the key word of a record
+static uint16_t recordAddress(uint16_t slot)
+{
+    return blockAddress(slot / JOURNAL_SLOTS) + 1 + ((slot % JOURNAL_SLOTS) * JOURNAL_RECORD_WORDS);
+}
+
+// Returns oldest block in use
+static uint8_t tailBlock(void)
+{
+    return (head + JOURNAL_BLOCKS + 1 - span) % JOURNAL_BLOCKS;
+}
+
+// Write one word, counting it towards the write amplification
+static void writeJournalWord(uint16_t add, uint32_t data)
+{
+    writeEeprom(add, data);
+    journalStats.words++;
+}
+
+// CRC-7 (x^7 + x^3 + 1) of the low bits of data added to crc, most
+// significant bit first
+static uint8_t crcBits(uint8_t crc, uint32_t data, uint8_t bits)
+{
+    while(bits > 0)
+    {
+        bits--;
+        crc = (((crc >> 6) ^ (data >> bits)) & 1) ? ((crc << 1) ^ 0x09) & 0x7F : (crc << 1) & 0x7F;
+    }
+
+    return crc;
+}
+
+// CRC-7 of a record's key, tombstone flag included, and data
+static uint8_t recordCrc(uint16_t key, uint16_t first, uint32_t second)
+{
+    uint8_t crc = 0x7F;
+
+    crc = crcBits(crc, key, 9);
+    crc = crcBits(crc, first, 16);
+
+    return crcBits(crc, second, 32);
+}
+
+// Returns header word of a block with sequence number, the low byte is a
+// CRC-8 of the magic number and sequence number
+static uint32_t blockHeader(uint32_t sequence)
+{
+    uint32_t header = ((uint32_t)JOURNAL_MAGIC << 28) | ((sequence & SEQUENCE_MASK) << 8);
+    uint8_t crc = 0, i;
+
+    for(i = 0; i < 24; i++)
+    {
+        crc = ((crc >> 7) ^ (header >> (31 - i))) & 1 ? (crc << 1) ^ 0x07 : crc << 1;
+    }
+
+    return header | crc;
+}
+
+// Returns true if block holds a valid header, and its sequence number
+static bool readHeader(uint8_t block, uint32_t* sequence)
+{
+    uint32_t header = readEeprom(blockAddress(block));
+
+    *sequence = (header >> 8) & SEQUENCE_MASK;
+
+    return header != JOURNAL_EMPTY && header == blockHeader(*sequence);
+}
+
+// Read a record, returns false if the slot is empty or the record is torn
+static bool readRecord(uint16_t slot, uint16_t* key, uint16_t* first, uint32_t* second)
+{
+    uint32_t data[JOURNAL_RECORD_WORDS];
+
+    readEepromWords(recordAddress(slot), data, JOURNAL_RECORD_WORDS);
+
+    *key = data[0] >> KEY_SHIFT;
+    *first = data[0] & 0xFFFF;
+    *second = data[1];
+
+    if(data[0] == JOURNAL_EMPTY || ((data[0] >> CRC_SHIFT) & 0x7F) != recordCrc(*key, *first, *second))
+    {
+        return false;
+    }
+
+    return (*key & KEY_MASK) < JOURNAL_KEYS;
+}
+
+// Append a record to the head block, the key word written last commits it
+static void putRecord(uint16_t key, uint16_t first, uint32_t second)
+{
+    uint16_t slot = (head * JOURNAL_SLOTS) + headSlot++;
+    uint16_t add = recordAddress(slot);
+
+    writeJournalWord(add + 1, second);
+    writeJournalWord(add, ((uint32_t)key << KEY_SHIFT) | ((uint32_t)recordCrc(key, first, second) << CRC_SHIFT) | first);
+
+    location[key & KEY_MASK] = slot;
+}
+
+// Take the next free block as head. Old records are cleared before the
+// header makes the block part of the journal.
+static void openBlock(void)
+{
+    uint8_t next = (head + 1) % JOURNAL_BLOCKS, i;
+
+    for(i = 1; i < EEPROM_BLOCK_WORDS; i++)
+    {
+        if(readEeprom(blockAddress(next) + i) != JOURNAL_EMPTY)
+        {
+            writeJournalWord(blockAddress(next) + i, JOURNAL_EMPTY);
+        }
+    }
+
+    head = next;
+    headSlot = 0;
+    span++;
+    sequence = (sequence + 1) & SEQUENCE_MASK;
+    writeJournalWord(blockAddress(head), blockHeader(sequence));
+}
+
+// Free the oldest block by copying its current records to the head block,
+// then clearing its header. The head must have room, which a block opened
+// just before always has. An erased key whose record reaches the oldest block
+// has no older record left to hide, so the erase is dropped.
+static void compactTail(void)
+{
+    uint8_t tail = tailBlock(), i;
+    uint16_t slot, key, first;
+    uint32_t second;
+
+    if(span <= 1)
+    {
+        return;
+    }
+
+    for(i = 0; i < JOURNAL_SLOTS; i++)
+    {
+        slot = (tail * JOURNAL_SLOTS) + i;
+
+        if(!readRecord(slot, &key, &first, &second) || location[key & KEY_MASK] != slot)
+        {
+            continue;
+        }
+
+        if(key & JOURNAL_TOMBSTONE)
+        {
+            location[key & KEY_MASK] = NO_LOCATION;
+            latest--;
+            erased--;
+        }
+        else
+        {
+            putRecord(key, first, second);
+            journalStats.copies++;
+        }
+    }
+
+    writeJournalWord(blockAddress(tail), JOURNAL_EMPTY);
+    span--;
+}
+
+// Open a new head block and, when that leaves fewer than two blocks free,
+// reclaim the oldest block into it. Two free blocks at rest mean a power cut
+// part way through leaves one free block for the mount to finish the job.
+static void advanceHead(void)
+{
+    openBlock();
+
+    if(span > JOURNAL_BLOCKS - 2)
+    {
+        compactTail();
+    }
+}
+
+// Append a record, moving on to the next block when the head is full
+static void appendRecord(uint16_t key, uint16_t first, uint32_t second)
+{
+    while(headSlot == JOURNAL_SLOTS)
+    {
+        advanceHead();
+    }
+
+    putRecord(key, first, second);
+}
+
+// Make room for a new key by reclaiming blocks until erased records are
+// dropped, returns false if the journal is full of current records
+static bool makeRoom(void)
+{
+    uint8_t i;
+
+    for(i = 0; latest >= JOURNAL_CAPACITY && erased > 0 && i < JOURNAL_BLOCKS; i++)
+    {
+        openBlock();
+        compactTail();
+    }
+
+    return latest < JOURNAL_CAPACITY;
+}
+
+// Find the newest block from the headers and the unbroken run of blocks
+// before it, then replay the key word of each of their records and pass the
+// latest record of each key to visitor. Only the latest records are read in
+// full. Returns false if the EEPROM holds no journal.
+bool mountJournal(JOURNAL_VISITOR visitor)
+{
+    uint32_t start = readCycleCounter(), blockSequence, second, keyWord;
+    uint16_t slot, key, first, torn = NO_LOCATION;
+    uint8_t block, i;
+    bool found = false;
+
+    for(block = 0; block < JOURNAL_BLOCKS; block++)
+    {
+        if(readHeader(block, &blockSequence)
+           && (!found || ((blockSequence - sequence) & SEQUENCE_MASK) < SEQUENCE_HALF))
+        {
+            found = true;
+            head = block;
+            sequence = blockSequence;
+        }
+    }
+
+    if(!found)
+    {
+        return false;
+    }
+
+    // Reclaimed blocks have no header, so the run stops at the oldest in use
+    for(span = 1; span < JOURNAL_BLOCKS; span++)
+    {
+        if(!readHeader((head + JOURNAL_BLOCKS - span) % JOURNAL_BLOCKS, &blockSequence)
+           || blockSequence != ((sequence - span) & SEQUENCE_MASK))
+        {
+            break;
+        }
+    }
+
+    for(key = 0; key < JOURNAL_KEYS; key++)
+    {
+        location[key] = NO_LOCATION;
+    }
+
+    latest = 0;
+    erased = 0;
+    headSlot = 0;
+
+    // Records are written in order, so only the last one in the head block
+    // can be torn: every other record had more writes after it. Appending
+    // resumes after the last good record and writes over a torn one.
+    for(slot = (head + 1) * JOURNAL_SLOTS; slot > head * JOURNAL_SLOTS; slot--)
+    {
+        if(readEeprom(recordAddress(slot - 1)) != JOURNAL_EMPTY)
+        {
+            if(readRecord(slot - 1, &key, &first, &second))
+            {
+                headSlot = slot - (head * JOURNAL_SLOTS);
+            }
+            else
+            {
+                torn = slot - 1;
+                headSlot = torn - (head * JOURNAL_SLOTS);
+            }
+            break;
+        }
+    }
+
+    // Replay oldest first so the latest record of a key is the one kept
+    for(i = span; i > 0; i--)
+    {
+        block = (head + JOURNAL_BLOCKS + 1 - i) % JOURNAL_BLOCKS;
+
+        for(slot = block * JOURNAL_SLOTS; slot < (block + 1) * JOURNAL_SLOTS; slot++)
+        {
+            keyWord = readEeprom(recordAddress(slot));
+            key = (keyWord >> KEY_SHIFT) & KEY_MASK;
+
+            if(keyWord == JOURNAL_EMPTY || key >= JOURNAL_KEYS || slot == torn)
+            {
+                continue;
+            }
+
+            if(location[key] == NO_LOCATION)
+            {
+                latest++;
+            }
+
+            location[key] = slot;
+        }
+    }
+
+    // Count erased keys before compaction, which drops erases it reclaims
+    for(key = 0; key < JOURNAL_KEYS; key++)
+    {
+        if(location[key] != NO_LOCATION && (readEeprom(recordAddress(location[key])) >> KEY_SHIFT) & JOURNAL_TOMBSTONE)
+        {
+            erased++;
+        }
+    }
+
+    // A power cut during compaction leaves only one block free, finish it.
+    // Records already copied now live in the head and are skipped.
+    if(span > JOURNAL_BLOCKS - 2)
+    {
+        compactTail();
+    }
+
+    for(key = 0; key < JOURNAL_KEYS; key++)
+    {
+        if(location[key] != NO_LOCATION && readRecord(location[key], &slot, &first, &second)
+           && !(slot & JOURNAL_TOMBSTONE))
+        {
+            visitor(key, first, second);
+        }
+    }
+
+    journalStats.mountCycles = readCycleCounter() - start;
+
+    return true;
+}
+
+// Start an empty journal in the first block. Other blocks only lose their
+// headers here, their records are cleared when each is opened.
+void formatJournal(void)
+{
+    uint8_t block;
+    uint16_t key;
+
+    for(block = 0; block < JOURNAL_BLOCKS; block++)
+    {
+        if(readEeprom(blockAddress(block)) != JOURNAL_EMPTY)
+        {
+            writeJournalWord(blockAddress(block), JOURNAL_EMPTY);
+        }
+    }
+
+    for(key = 0; key < JOURNAL_KEYS; key++)
+    {
+        location[key] = NO_LOCATION;
+    }
+
+    latest = 0;
+    erased = 0;
+    head = JOURNAL_BLOCKS - 1;
+    span = 0;
+    sequence = SEQUENCE_MASK;
+
+    openBlock();
+}
+
+// Store a data halfword and word under key unless they are already its latest
+// record. Returns false if key is new and the journal is full.
+bool writeJournal(uint16_t key, uint16_t first, uint32_t second)
+{
+    uint16_t stored, storedFirst;
+    uint32_t storedSecond;
+
+    if(location[key] == NO_LOCATION)
+    {
+        if(!makeRoom())
+        {
+            return false;
+        }
+
+        latest++;
+    }
+    else
+    {
+        if(readRecord(location[key], &stored, &storedFirst, &storedSecond)
+           && stored == key && storedFirst == first && storedSecond == second)
+        {
+            journalStats.skipped++;
+            return true;
+        }
+
+        // Move to the next block first, reclaiming the oldest may drop an
+        // erase of key and count it out
+        while(headSlot == JOURNAL_SLOTS)
+        {
+            advanceHead();
+        }
+
+        if(location[key] == NO_LOCATION)
+        {
+            latest++;
+        }
+        else if(readRecord(location[key], &stored, &storedFirst, &storedSecond)
+                && (stored & JOURNAL_TOMBSTONE))
+        {
+            erased--;
+        }
+    }
+
+    appendRecord(key, first, second);
+    journalStats.records++;
+
+    return true;
+}
+
+// Mark key erased so older records of it are ignored
+bool eraseJournal(uint16_t key)
+{
+    uint16_t stored, first;
+    uint32_t second;
+
+    if(location[key] == NO_LOCATION
+       || (readRecord(location[key], &stored, &first, &second) && (stored & JOURNAL_TOMBSTONE)))
+    {
+        journalStats.skipped++;
+        return true;
+    }
+
+    appendRecord(key | JOURNAL_TOMBSTONE, 0, 0);
+    journalStats.records++;
+    erased++;
+
+    return true;
+}
+
+// Returns number of keys holding a record, erased keys not yet dropped included
+uint16_t countJournal(void)
+{
+    return latest;
+}
+
+// Display journal usage and cost
+void printJournal(void)
+{
+    sendUart0String("  journal: ");
+    sendUart0Unsigned(latest);
+    sendUart0String(" of ");
+    sendUart0Unsigned(JOURNAL_CAPACITY);
+    sendUart0String(" records, ");
+    sendUart0Unsigned(span);
+    sendUart0String(" of ");
+    sendUart0Unsigned(JOURNAL_BLOCKS);
+    sendUart0String(" blocks, mount ");
+    sendUart0Unsigned(cyclesToMicroseconds(journalStats.mountCycles));
+    sendUart0String(" us\r\n");
+
+    sendUart0String("  ");
+    sendUart0Unsigned(journalStats.records);
+    sendUart0String(" records, ");
+    sendUart0Unsigned(journalStats.skipped);
+    sendUart0String(" unchanged, ");
+    sendUart0Unsigned(journalStats.copies);
+    sendUart0String(" copied, ");
+    sendUart0Unsigned(journalStats.words);
+    sendUart0String(" words written");
+
+    // Write amplification against the record words callers asked for
+    if(journalStats.records > 0)
+    {
+        sendUart0String(", amplification ");
+        sendUart0Fixed((journalStats.words * 100) / (journalStats.records * JOURNAL_RECORD_WORDS), 2);
+    }
+
+    sendUart0String("\r\n");
+}
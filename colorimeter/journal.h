@@ -0,0 +1,79 @@
+// journal.h
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#ifndef JOURNAL_H_
+#define JOURNAL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "eeprom.h"
+
+//
+// Defines
+//
+
+// The journal is a ring of EEPROM blocks written in order. Each block in use
+// starts with a header word, bits 31..28 JOURNAL_MAGIC, bits 27..8 a sequence
+// number and bits 7..0 a CRC-8, followed by JOURNAL_SLOTS records of two
+// words: a key word with the key in bits 31..23, a CRC-7 of the record in
+// bits 22..16 and the first data halfword in bits 15..0, then the second data
+// word. The last word of each block is unused.
+#define JOURNAL_FIRST_BLOCK  0
+#define JOURNAL_BLOCKS       MACRO_BLOCK
+#define JOURNAL_RECORD_WORDS 2
+#define JOURNAL_SLOTS        ((EEPROM_BLOCK_WORDS - 1) / JOURNAL_RECORD_WORDS)
+#define JOURNAL_MAGIC        0xB                 // 0xA was the three word record layout
+#define JOURNAL_EMPTY        0xFFFFFFFF
+#define JOURNAL_TOMBSTONE    0x100               // key flag of an erased record
+
+// Keys, one per color reference followed by the other records
+#define KEY_CALIBRATION      TOTAL_COLORS
+#define KEY_SETTINGS         (TOTAL_COLORS + 1)
+#define JOURNAL_KEYS         (TOTAL_COLORS + 2)
+
+// Two blocks are kept free and one more is always being compacted, so current
+// records always fit in the rest
+#define JOURNAL_CAPACITY     ((JOURNAL_BLOCKS - 3) * JOURNAL_SLOTS)
+#define MAX_STORED_COLORS    (JOURNAL_CAPACITY - 2)
+
+#if MAX_STORED_COLORS < TOTAL_COLORS
+#error "The journal must hold a record for every color reference"
+#endif
+
+typedef void (*JOURNAL_VISITOR)(uint16_t key, uint16_t first, uint32_t second);
+
+// Cost counters, words counts every EEPROM word written by the journal
+typedef struct _JOURNAL_STATS
+{
+    uint32_t mountCycles;
+    uint32_t records;                           // records appended for callers
+    uint32_t skipped;                           // appends that matched the stored record
+    uint32_t copies;                            // records moved by compaction
+    uint32_t words;
+} JOURNAL_STATS;
+
+//
+// Global Variables
+//
+extern JOURNAL_STATS journalStats;
+
+//
+// Definitions
+//
+bool mountJournal(JOURNAL_VISITOR visitor);
+void formatJournal(void);
+bool writeJournal(uint16_t key, uint16_t first, uint32_t second);
+bool eraseJournal(uint16_t key);
+uint16_t countJournal(void);
+void printJournal(void);
+
+#endif /* JOURNAL_H_ */
@@ -0,0 +1,161 @@
+// lab.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+// Integer conversion of calibrated RGB triplets to CIELAB (D65 white) for
+// perceptual color matching. Uses an sRGB gamma table, a 3x3 matrix with the
+// white point folded in and an interpolated cube root table, all in flash.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "eeprom.h"
+#include "grid.h"
+#include "lab.h"
+
+uint8_t matchMetric = MATCH_RGB;
+
+// L*, a*, b* of each color reference, updated when the color is learned
+static int16_t colorLab[TOTAL_COLORS][3];
+
+// sRGB channel value to linear intensity, 0..65535
+static const uint16_t gammaTable[256] =
+{
+        0,    20,    40,    60,    80,    99,   119,   139,   159,   179,   199,   219,
+      241,   264,   288,   313,   340,   367,   396,   427,   458,   491,   526,   562,
+      599,   637,   677,   718,   761,   805,   851,   898,   947,   997,  1048,  1101,
+     1156,  1212,  1270,  1330,  1391,  1453,  1517,  1583,  1651,  1720,  1790,  1863,
+     1937,  2013,  2090,  2170,  2250,  2333,  2418,  2504,  2592,  2681,  2773,  2866,
+     2961,  3058,  3157,  3258,  3360,  3464,  3570,  3678,  3788,  3900,  4014,  4129,
+     4247,  4366,  4488,  4611,  4736,  4864,  4993,  5124,  5257,  5392,  5530,  5669,
+     5810,  5953,  6099,  6246,  6395,  6547,  6700,  6856,  7014,  7174,  7335,  7500,
+     7666,  7834,  8004,  8177,  8352,  8528,  8708,  8889,  9072,  9258,  9445,  9635,
+     9828, 10022, 10219, 10417, 10619, 10822, 11028, 11235, 11446, 11658, 11873, 12090,
+    12309, 12530, 12754, 12980, 13209, 13440, 13673, 13909, 14146, 14387, 14629, 14874,
+    15122, 15371, 15623, 15878, 16135, 16394, 16656, 16920, 17187, 17456, 17727, 18001,
+    18277, 18556, 18837, 19121, 19407, 19696, 19987, 20281, 20577, 20876, 21177, 21481,
+    21787, 22096, 22407, 22721, 23038, 23357, 23678, 24002, 24329, 24658, 24990, 25325,
+    25662, 26001, 26344, 26688, 27036, 27386, 27739, 28094, 28452, 28813, 29176, 29542,
+    29911, 30282, 30656, 31033, 31412, 31794, 32179, 32567, 32957, 33350, 33745, 34143,
+    34544, 34948, 35355, 35764, 36176, 36591, 37008, 37429, 37852, 38278, 38706, 39138,
+    39572, 40009, 40449, 40891, 41337, 41785, 42236, 42690, 43147, 43606, 44069, 44534,
+    45002, 45473, 45947, 46423, 46903, 47385, 47871, 48359, 48850, 49344, 49841, 50341,
+    50844, 51349, 51858, 52369, 52884, 53401, 53921, 54445, 54971, 55500, 56032, 56567,
+    57105, 57646, 58190, 58737, 59287, 59840, 60396, 60955, 61517, 62082, 62650, 63221,
+    63795, 64372, 64952, 65535
+};
+
+// CIELAB f(t) = cbrt(t), or its linear segment for small t, sampled at
+// t = i/256 in units of 1/32768
+static const uint16_t cubeRootTable[257] =
+{
+     4520,  5516,  6513,  7443,  8192,  8825,  9377,  9872, 10321, 10735, 11118, 11477,
+    11815, 12134, 12438, 12727, 13004, 13269, 13525, 13771, 14008, 14238, 14460, 14676,
+    14886, 15090, 15288, 15482, 15671, 15855, 16035, 16212, 16384, 16553, 16718, 16881,
+    17040, 17196, 17350, 17501, 17649, 17795, 17939, 18080, 18219, 18356, 18491, 18624,
+    18755, 18884, 19012, 19138, 19262, 19385, 19506, 19626, 19744, 19861, 19976, 20090,
+    20203, 20315, 20425, 20534, 20643, 20750, 20855, 20960, 21064, 21167, 21268, 21369,
+    21469, 21568, 21666, 21763, 21860, 21955, 22050, 22143, 22237, 22329, 22420, 22511,
+    22601, 22690, 22779, 22867, 22954, 23041, 23127, 23212, 23297, 23381, 23465, 23547,
+    23630, 23712, 23793, 23873, 23954, 24033, 24112, 24191, 24269, 24346, 24423, 24500,
+    24576, 24652, 24727, 24801, 24876, 24950, 25023, 25096, 25168, 25241, 25312, 25384,
+    25454, 25525, 25595, 25665, 25734, 25803, 25872, 25940, 26008, 26076, 26143, 26210,
+    26276, 26342, 26408, 26474, 26539, 26604, 26668, 26733, 26797, 26860, 26924, 26987,
+    27049, 27112, 27174, 27236, 27298, 27359, 27420, 27481, 27541, 27602, 27662, 27721,
+    27781, 27840, 27899, 27958, 28016, 28074, 28132, 28190, 28248, 28305, 28362, 28419,
+    28476, 28532, 28588, 28644, 28700, 28755, 28811, 28866, 28921, 28975, 29030, 29084,
+    29138, 29192, 29246, 29299, 29352, 29405, 29458, 29511, 29564, 29616, 29668, 29720,
+    29772, 29823, 29875, 29926, 29977, 30028, 30079, 30129, 30180, 30230, 30280, 30330,
+    30379, 30429, 30478, 30528, 30577, 30626, 30674, 30723, 30771, 30820, 30868, 30916,
+    30964, 31012, 31059, 31107, 31154, 31201, 31248, 31295, 31341, 31388, 31434, 31481,
+    31527, 31573, 31619, 31665, 31710, 31756, 31801, 31846, 31891, 31936, 31981, 32026,
+    32071, 32115, 32159, 32204, 32248, 32292, 32336, 32379, 32423, 32467, 32510, 32553,
+    32596, 32639, 32682, 32725, 32767
+};
+
+// Linear sRGB to XYZ / white point (D65) in units of 1/16384
+static const int16_t xyzMatrix[3][3] =
+{
+    {7110,  6164, 3110},
+    {3484, 11717, 1183},
+    { 291,  1794, 14299}
+};
+
+// Returns f(t) in units of 1/32768 for t in units of 1/65536
+static int32_t labFunction(uint32_t t)
+{
+    uint32_t i = t >> 8, fraction = t & 0xFF;
+
+    return cubeRootTable[i] + (((cubeRootTable[i + 1] - cubeRootTable[i]) * (int32_t)fraction) >> 8);
+}
+
+// Convert calibrated RGB triplet to L*, a*, b* in units of 1/16
+void rgbToLab(uint8_t red, uint8_t green, uint8_t blue, int16_t lab[3])
+{
+    const uint32_t linear[3] = {gammaTable[red], gammaTable[green], gammaTable[blue]};
+    int32_t f[3];
+    uint32_t t;
+    uint8_t row;
+
+    for(row = 0; row < 3; row++)
+    {
+        t = (xyzMatrix[row][0] * linear[0] + xyzMatrix[row][1] * linear[1] + xyzMatrix[row][2] * linear[2]) >> 14;
+        f[row] = labFunction(t > 65535 ? 65535 : t);
+    }
+
+    lab[0] = ((116 * 16 * f[1]) >> 15) - (16 * 16);
+    lab[1] = (500 * 16 * (f[0] - f[1])) >> 15;
+    lab[2] = (200 * 16 * (f[1] - f[2])) >> 15;
+}
+
+// Precompute L*, a*, b* of a color reference
+void updateColorLab(uint16_t index)
+{
+    uint32_t rgb = color.rgb[index];
+
+    rgbToLab(COLOR_RED(rgb), COLOR_GREEN(rgb), COLOR_BLUE(rgb), colorLab[index]);
+}
+
+// Returns squared CIE76 color difference in units of 1/256
+uint32_t deltaE76Squared(const int16_t first[3], const int16_t second[3])
+{
+    int32_t dl = first[0] - second[0];
+    int32_t da = first[1] - second[1];
+    int32_t db = first[2] - second[2];
+
+    return (dl * dl) + (da * da) + (db * db);
+}
+
+// Call visitor for every learned color with a CIE76 difference less than e
+// from the sample. Returns number found.
+uint16_t findLabColorsWithin(uint8_t red, uint8_t green, uint8_t blue, uint16_t e, GRID_VISITOR visitor)
+{
+    int16_t sample[3];
+    uint16_t i, count = 0;
+    uint32_t distance, limit = ((uint32_t)e * e) << (2 * LAB_SHIFT);
+
+    rgbToLab(red, green, blue, sample);
+
+    for(i = 0; i < TOTAL_COLORS; i++)
+    {
+        if(isColorValid(i))
+        {
+            distance = deltaE76Squared(sample, colorLab[i]);
+
+            if(distance < limit)
+            {
+                visitor(i, distance);
+                count++;
+            }
+        }
+    }
+
+    return count;
+}
@@ -0,0 +1,40 @@
+// lab.h
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#ifndef LAB_H_
+#define LAB_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "grid.h"
+
+//
+// Defines
+//
+#define LAB_SHIFT   4                   // L*, a* and b* are kept in units of 1/16
+#define MATCH_RGB   0
+#define MATCH_LAB   1
+
+//
+// Global Variables
+//
+extern uint8_t matchMetric;
+
+//
+// Definitions
+//
+void rgbToLab(uint8_t red, uint8_t green, uint8_t blue, int16_t lab[3]);
+void updateColorLab(uint16_t index);
+uint32_t deltaE76Squared(const int16_t first[3], const int16_t second[3]);
+uint16_t findLabColorsWithin(uint8_t red, uint8_t green, uint8_t blue, uint16_t e, GRID_VISITOR visitor);
+
+#endif /* LAB_H_ */
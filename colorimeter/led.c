@@ -1,319 +1,543 @@
-// led.h
-// William Bozarth
-// Created on: October 8, 2020
-
-//-----------------------------------------------------------------------------
-// Hardware Target
-//-----------------------------------------------------------------------------
-
-// Target Platform: EK-TM4C123GXL Evaluation Board
-// Target uC:       TM4C123GH6PM
-// System Clock:    40 MHz
-
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <math.h>
-#include "uart0.h"
-#include "gpio.h"
-#include "pwm0.h"
-#include "adc0.h"
-#include "wait.h"
-#include "eeprom.h"
-#include "led.h"
-
-DELTA_MODE delta = {0};
-
-bool sampleLed = false;
-
-//----- Trigger Variables ---------------
-uint16_t ledRed = 0;
-uint16_t ledGreen = 0;
-uint16_t ledBlue = 0;
-
-//------- Test Variables ---------------
-uint16_t redLedCal[1024] = {0};
-uint16_t greenLedCal[1024] = {0};
-uint16_t blueLedCal[1024] = {0};
-uint16_t rgbLeds[3] = {0};
-bool validTest = false;
-bool printTest = false;
-
-//-------- match E Variables ------------
-uint8_t matchValue = 0;
-float eColor = 0.0;
-bool matchMode = false;
-bool match = false;
-bool testMode = false;
-
-//Return LED Value for Passing to setRgbColor()
-uint16_t getRgbValue(char * buffer)
-{
-    uint16_t led;
-
-    //fetch value from 0 ---> 1023 and store in buffer. Convert string to integer and return
-    //the integer back to parent function.
-
-    //getsUart0(buffer, QUEUE_BUFFER_LENGTH);
-    led = atoi(buffer);
-
-    return led;
-}
-
-//function to test led functionality
-void testLED(void)
-{
-    setRgbColor(0,0,0);
-
-    sendUart0String("  wait....\r\n");
-
-    // Ramp Red LED
-    rampLed(redLedCal, rgbLeds, 0);
-
-    // Turn off all LEDs
-    setRgbColor(0,0,0);
-
-    // Ramp Green LED
-    rampLed(greenLedCal, rgbLeds, 1);
-
-    // Turn off all LEDs
-    setRgbColor(0,0,0);
-
-    // Ramp Blue LED
-    rampLed(blueLedCal, rgbLeds, 2);
-
-    // Turn off all LEDs
-    setRgbColor(0,0,0);
-
-    validTest = true;
-    testMode = false;
-}
-
-// Function to ramp led from 0 -> 1023
-void rampLed(uint16_t ledCal[], uint16_t leds[], uint8_t setLed)
-{
-    int i, num;
-    char buffer[QUEUE_BUFFER_LENGTH];
-
-    //Ramp Red LED
-    for (i = 0; i < 1024; i++)
-    {
-        switch(setLed)
-        {
-        case 0:
-            setRgbColor(i, 0, 0);
-            break;
-        case 1:
-            setRgbColor(0, i, 0);
-            break;
-        case 2:
-            setRgbColor(0, 0, i);
-            break;
-        default:
-            break;
-        }
-
-        waitMicrosecond(RAMP_SPEED);
-        num = readRawResult();
-
-        if(testMode)
-        {
-            ledCal[i] = num;
-        }
-        else if(calibrateMode && num <= threshold)
-        {
-            leds[setLed] = i;
-        }
-        else if(calibrateMode && num > threshold)
-        {
-            break;
-        }
-
-        if(printTest)
-        {
-            //no spaces between the 4 numbers as these are copy and pasted
-            //into excel for plotting purposes.
-            snprintf(buffer, sizeof(buffer), "  %d,%u\r\n", i, num);
-            sendUart0String(buffer);
-        }
-    }
-}
-
-void calibrateLed(int threshold)
-{
-    char buffer[QUEUE_BUFFER_LENGTH];
-
-    if(0 <= threshold && threshold <= 4095)
-    {
-        testLED();
-
-        validCalibration = true;
-
-        snprintf(buffer, sizeof(buffer), "  [PWMr: %u,PWMg: %u,PWMb: %u]\r\n", rgbLeds[0], rgbLeds[1], rgbLeds[2]);
-        sendUart0String(buffer);
-    }
-    else
-    {
-        sendUart0String("  Threshold NOT in 0 to 4095 range.\r\n");
-    }
-
-    calibrateMode = false;
-}
-
-//Function to call when needing to measure for trigger and button commands
-void getMeasurement(void)
-{
-    char buffer[QUEUE_BUFFER_LENGTH];
-    uint16_t temp = 0;
-
-    if(validCalibration == true)
-    {
-        //store Red LED value
-        setRgbColor(0,0,0);
-        setRgbColor(rgbLeds[0], 0, 0);
-        waitMicrosecond(20000);
-        temp = readRawResult();
-        ledRed = normalizeRgbColor(temp);
-
-        //store Green LED value
-        setRgbColor(0,0,0);
-        setRgbColor(0, rgbLeds[1], 0);
-        waitMicrosecond(20000);
-        temp = readRawResult();
-        ledGreen = normalizeRgbColor(temp);
-
-        //store Blue LED value
-        setRgbColor(0,0,0);
-        setRgbColor(0, 0, rgbLeds[2]);
-        waitMicrosecond(20000);
-        temp = readRawResult();
-        ledBlue = normalizeRgbColor(temp);
-
-        //turn of r,g,b LEDS after measurements
-        setRgbColor(0, 0, 0);
-
-        if(delta.mode == true)
-        {
-            // Need to modify index values
-            deltaD();
-        }
-
-        //if match mode is turned on calculate the Euclidean Distance between measured value
-        //and stored colors. If eColor < matchValue then display matched color on terminal
-        if(matchMode == true)
-        {
-            for(color.index = 0; color.index < TOTAL_COLORS; color.index++)
-            {
-                if(color.validBit[color.index])
-                {
-                    euclidNorm();
-
-                    if(eColor < matchValue)
-                    {
-                        snprintf(buffer, sizeof(buffer), "  color %u\r\n", color.index);
-                        sendUart0String(buffer);
-                    }
-                }
-            }
-        }
-
-        if(sampleLed)
-        {
-            setPinValue(GREEN_LED, 1);
-        }
-        waitMicrosecond(10000);
-
-        //If in delta mode and change in r,g,b is greater than deltaValue then print new values
-        if(delta.mode == true && delta.difference > delta.value)
-        {
-            //print raw results in comparison
-            snprintf(buffer, sizeof(buffer), "  %u,%u,%u\r\n", ledRed, ledGreen, ledBlue);
-            sendUart0String(buffer);
-        }
-        //if not in delta mode print measured values
-        else if(!delta.mode)
-        {
-            //print raw results in comparison
-            snprintf(buffer, sizeof(buffer), "  %u,%u,%u\r\n", ledRed, ledGreen, ledBlue);
-            sendUart0String(buffer);
-        }
-
-        // Turn on-board GREEN LED ON if sampleLED mask is True
-        if(sampleLed)
-        {
-            setPinValue(GREEN_LED, 1);
-        }
-    }
-    else
-    {
-        sendUart0String("  No calibration performed.\r\n");
-    }
-}
-
-//return measured value in the range of 0... 255 using
-// m = (m/th)*(tMax-tMin), where th = threshold, tMax
-//and tMin is target max and min, and m = measured value
-int normalizeRgbColor(int measurement)
-{
-    int temp;
-    float numerator, denominator, ratio;
-    char buffer[QUEUE_BUFFER_LENGTH];
-
-    snprintf(buffer, sizeof(buffer), "%u.0\0",measurement);
-    numerator = atof(buffer);
-    snprintf(buffer, sizeof(buffer), "%u.0\0",threshold);
-    denominator = atof(buffer);
-    ratio = (numerator / denominator) * 255.0;
-    temp = ratio;
-
-    if(temp > 255)
-    {
-        temp = 255;
-    }
-
-    return temp;
-}
-
-//function to set the delta value for displaying measured values when greater than D
-void deltaD(void)
-{
-    float avg = 0.0;
-
-    delta.methodResult = sqrt((ledRed * ledRed) + (ledGreen * ledGreen) + (ledBlue * ledBlue));
-    delta.sum -= delta.methodValues[delta.index];
-    delta.sum += delta.methodResult;
-    delta.methodValues[delta.index] = delta.methodResult;
-    delta.index = ++delta.index % 16;
-
-    avg = 0.9*(delta.sum/16) + (0.1 * delta.methodResult);
-    delta.difference = abs((int)delta.methodResult - (int)avg);
-}
-
-//function used to calculate the Euclidean distance
-void euclidNorm(void)
-{
-    uint16_t colorDiffRed, colorDiffBlue, colorDiffGreen;
-    float red, green, blue;
-    char buffer[QUEUE_BUFFER_LENGTH];
-
-    //calculate (r - ri)^2
-    colorDiffRed= ledRed - color.redValue[color.index];
-    colorDiffRed = colorDiffRed * colorDiffRed;
-    snprintf(buffer, sizeof(buffer), "%u.0\0",colorDiffRed);
-    red = atof(buffer);
-
-    //calculate (g - gi)^2
-    colorDiffGreen = ledGreen - color.greenValue[color.index];
-    colorDiffGreen = colorDiffGreen * colorDiffGreen;
-    snprintf(buffer, sizeof(buffer), "%u.0\0",colorDiffGreen);
-    green = atof(buffer);
-
-    //calculate (b - bi)^2
-    colorDiffBlue = ledBlue - color.blueValue[color.index];
-    colorDiffBlue = colorDiffBlue * colorDiffBlue;
-    snprintf(buffer, sizeof(buffer), "%u.0\0",colorDiffBlue);
-    blue = atof(buffer);
-
-    //calculate square root of above differences
-    eColor= sqrt (red + green + blue);
-}
+// led.h
+// William Bozarth
+// Created on: October 8, 2020
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "uart0.h"
+#include "gpio.h"
+#include "pwm0.h"
+#include "adc0.h"
+#include "wait.h"
+#include "eeprom.h"
+#include "format.h"
+#include "grid.h"
+#include "lab.h"
+#include "model.h"
+#include "rank.h"
+#include "stable.h"
+#include "cache.h"
+#include "logger.h"
+#include "tasks.h"
+#include "timers.h"
+#include "interrupts.h"
+#include "timestamp.h"
+#include "profile.h"
+#include "stats.h"
+#include "led.h"
+
+DELTA_MODE delta = {0};
+
+bool sampleLed = false;
+static TASK_TIMER blinkTimer = {0};
+
+//----- Trigger Variables ---------------
+uint32_t settleTime = SETTLE_TIME;
+uint16_t ledRed = 0;
+uint16_t ledGreen = 0;
+uint16_t ledBlue = 0;
+uint64_t sampleTime = 0;
+
+// Channel an alarm driven measurement is settling, and what runs after it
+static uint8_t measureChannel = 0;
+static uint32_t measureSettle;
+static DEFERRED_WORK measureDone = 0;
+
+//------- Test Variables ---------------
+uint16_t redLedCal[1024] = {0};
+uint16_t greenLedCal[1024] = {0};
+uint16_t blueLedCal[1024] = {0};
+uint16_t rgbLeds[3] = {0};
+uint16_t rampLength[3] = {0};
+bool validTest = false;
+bool printTest = false;
+uint8_t rampFormat = RAMP_CSV;
+
+//-------- match E Variables ------------
+uint8_t matchValue = 0;
+bool matchMode = false;
+bool match = false;
+bool testMode = false;
+
+// Candidates of the current sample, closest first once sorted
+static RANKING matches;
+
+// Offer a color reference that matched the sample to the ranking
+static void rankMatch(uint16_t index, uint32_t distanceSquared)
+{
+    uint8_t confidence = NO_CONFIDENCE;
+
+    // Colors learned from several samples are also scored against their
+    // spread, so a sample inside E but outside the class is not a match
+    if(color.model[index] & MODEL_VALID)
+    {
+        confidence = modelConfidence(mahalanobisSquared(color.model[index], color.rgb[index], ledRed, ledGreen, ledBlue));
+
+        if(confidence < MIN_CONFIDENCE)
+        {
+            return;
+        }
+    }
+
+    offerRanking(&matches, index, distanceSquared, confidence);
+}
+
+// Rank the colors within matchValue of the sample, keeping size entries. When
+// only the best match is wanted in RGB, the nearest color query answers it
+// without visiting every cell within E, unless its class model rejects it.
+static void findMatches(uint8_t size)
+{
+    uint32_t distance;
+    uint16_t nearest;
+
+    resetRanking(&matches, size);
+
+    if(matchMetric == MATCH_LAB)
+    {
+        findLabColorsWithin(ledRed, ledGreen, ledBlue, matchValue, rankMatch);
+        return;
+    }
+
+    if(size == 1)
+    {
+        nearest = findNearestColor(ledRed, ledGreen, ledBlue, &distance);
+
+        if(nearest == NO_COLOR || distance >= (uint32_t)matchValue * matchValue)
+        {
+            return;
+        }
+
+        rankMatch(nearest, distance);
+
+        if(matches.count > 0)
+        {
+            return;
+        }
+    }
+
+    findColorsWithin(ledRed, ledGreen, ledBlue, matchValue, rankMatch);
+}
+
+// Report a new stable match state
+static void printStableState(void)
+{
+    if(stable.state == STABLE_NONE)
+    {
+        sendUart0String("  ");
+        sendUart0Stamp(sampleTime, ' ');
+        sendUart0String("stable none\r\n");
+    }
+    else
+    {
+        sendUart0String("  ");
+        sendUart0Stamp(sampleTime, ' ');
+        sendUart0String("stable ");
+        sendUart0Unsigned(stable.state);
+        sendUart0String("\r\n");
+    }
+}
+
+//function to test led functionality
+void testLED(void)
+{
+    setRgbColor(0,0,0);
+
+    sendUart0String("  wait....\r\n");
+
+    // Ramp Red LED
+    rampLed(redLedCal, rgbLeds, 0);
+
+    // Turn off all LEDs
+    setRgbColor(0,0,0);
+
+    // Ramp Green LED
+    rampLed(greenLedCal, rgbLeds, 1);
+
+    // Turn off all LEDs
+    setRgbColor(0,0,0);
+
+    // Ramp Blue LED
+    rampLed(blueLedCal, rgbLeds, 2);
+
+    // Turn off all LEDs
+    setRgbColor(0,0,0);
+
+    validTest = true;
+    testMode = false;
+
+    // Stream captured table once ramps are done so output never delays a step
+    if(printTest)
+    {
+        printRampTable();
+    }
+}
+
+// Function to ramp led from 0 -> 1023, capturing each raw reading in ledCal[]
+void rampLed(uint16_t ledCal[], uint16_t leds[], uint8_t setLed)
+{
+    int i, num;
+
+    //Ramp Red LED
+    for (i = 0; i < 1024; i++)
+    {
+        switch(setLed)
+        {
+        case 0:
+            setRgbColor(i, 0, 0);
+            break;
+        case 1:
+            setRgbColor(0, i, 0);
+            break;
+        case 2:
+            setRgbColor(0, 0, i);
+            break;
+        default:
+            break;
+        }
+
+        waitMicrosecond(RAMP_SPEED);
+        num = readRawResult();
+        ledCal[i] = num;
+
+        if(calibrateMode && num <= threshold)
+        {
+            leds[setLed] = i;
+        }
+        else if(calibrateMode && num > threshold)
+        {
+            break;
+        }
+    }
+
+    rampLength[setLed] = i;
+}
+
+// Stream the readings captured by the last ramp of each LED, either one
+// "step,reading" line per step or, in RAMP_DELTA format, the first reading
+// followed by the change from the previous step, 16 per line
+void printRampTable(void)
+{
+    uint16_t* const tables[3] = {redLedCal, greenLedCal, blueLedCal};
+    const char* names[3] = {"  red,", "  green,", "  blue,"};
+    uint8_t led;
+    uint16_t i;
+
+    for(led = 0; led < 3; led++)
+    {
+        if(rampFormat == RAMP_DELTA)
+        {
+            sendUart0StringLiteral(names[led]);
+            sendUart0Unsigned(rampLength[led]);
+        }
+
+        for(i = 0; i < rampLength[led]; i++)
+        {
+            if(rampFormat == RAMP_DELTA)
+            {
+                sendUart0String((i % 16) ? "," : "\r\n  ");
+                sendUart0Signed(i ? (int32_t)tables[led][i] - tables[led][i - 1] : tables[led][i]);
+            }
+            else
+            {
+                //no spaces between the numbers as these are copy and pasted
+                //into excel for plotting purposes.
+                sendUart0String("  ");
+                sendUart0Unsigned(i);
+                sendUart0String(",");
+                sendUart0Unsigned(tables[led][i]);
+                sendUart0String("\r\n");
+            }
+        }
+
+        if(rampFormat == RAMP_DELTA)
+        {
+            sendUart0String("\r\n");
+        }
+    }
+}
+
+void calibrateLed(int threshold)
+{
+    if(0 <= threshold && threshold <= 4095)
+    {
+        testLED();
+
+        validCalibration = true;
+
+        sendUart0String("  [PWMr: ");
+        sendUart0Unsigned(rgbLeds[0]);
+        sendUart0String(",PWMg: ");
+        sendUart0Unsigned(rgbLeds[1]);
+        sendUart0String(",PWMb: ");
+        sendUart0Unsigned(rgbLeds[2]);
+        sendUart0String("]\r\n");
+    }
+    else
+    {
+        sendUart0String("  Threshold NOT in 0 to 4095 range.\r\n");
+    }
+
+    calibrateMode = false;
+}
+
+// Light the calibrated LED of channel 0, 1 or 2 (red, green or blue) alone
+static void lightChannel(uint8_t channel)
+{
+    setRgbColor(0,0,0);
+    setRgbColor((channel == 0) ? rgbLeds[0] : 0, (channel == 1) ? rgbLeds[1] : 0, (channel == 2) ? rgbLeds[2] : 0);
+}
+
+// Store the normalized sensor reading of a channel, the sample is stamped
+// with the time of its first capture
+static void readChannel(uint8_t channel)
+{
+    uint16_t raw = readRawResult(), temp;
+
+    PROFILE_BEGIN(PROBE_NORMALIZE);
+    temp = normalizeRgbColor(raw);
+    PROFILE_END(PROBE_NORMALIZE);
+
+    if(channel == 0)
+    {
+        sampleTime = readTimestamp();
+        ledRed = temp;
+    }
+    else if(channel == 1)
+    {
+        ledGreen = temp;
+    }
+    else
+    {
+        ledBlue = temp;
+    }
+}
+
+// Measure the target under each calibrated LED in turn, storing the
+// normalized result in ledRed, ledGreen and ledBlue
+void measureRgb(void)
+{
+    uint8_t channel;
+
+    for(channel = 0; channel < 3; channel++)
+    {
+        lightChannel(channel);
+        waitMicrosecond(settleTime);
+        readChannel(channel);
+    }
+
+    //turn of r,g,b LEDS after measurements
+    setRgbColor(0, 0, 0);
+}
+
+// Read the channel that settled and light the next, run by the alarm
+static void measureChannelAlarm(void)
+{
+    PROFILE_BEGIN(PROBE_CHANNEL);
+
+    readChannel(measureChannel);
+
+    if(++measureChannel < 3)
+    {
+        lightChannel(measureChannel);
+        setAlarm(deadlineAfter(measureSettle), measureChannelAlarm);
+    }
+    else
+    {
+        setRgbColor(0, 0, 0);
+        deferWork(measureDone);
+    }
+
+    PROFILE_END(PROBE_CHANNEL);
+}
+
+// Measure like measureRgb() without waiting: each settle time of settle us
+// ends in an alarm, and done runs as deferred work once all three channels
+// are read
+void startMeasurement(uint32_t settle, void (*done)(void))
+{
+    measureChannel = 0;
+    measureSettle = settle;
+    measureDone = done;
+
+    lightChannel(0);
+    setAlarm(deadlineAfter(settle), measureChannelAlarm);
+}
+
+// Returns how long getMeasurement() takes in us, the shortest usable period
+uint32_t measurementTime(void)
+{
+    return (3 * settleTime) + MEASUREMENT_MARGIN;
+}
+
+// Blink task, ends the status LED blink of the last sample unless the LED
+// was switched to steady on or off since
+void endSampleBlink(void)
+{
+    if(sampleLed)
+    {
+        setPinValue(GREEN_LED, 0);
+    }
+}
+
+// Log, match and print the sample in ledRed, ledGreen and ledBlue
+void reportMeasurement(void)
+{
+    bool quiet = false, emitted = false;
+    uint8_t size;
+
+    PROFILE_BEGIN(PROBE_REPORT);
+
+    COUNT_STAT(STAT_SAMPLES);
+
+    if(logMode)
+    {
+        logSample((uint32_t)(sampleTime / 1000), ledRed, ledGreen, ledBlue);
+    }
+
+    if(delta.mode == true)
+    {
+        // Need to modify index values
+        deltaD();
+    }
+
+    //if match mode is turned on display the closest stored colors whose Euclidean Distance
+    //from the measured value is less than matchValue, searching only nearby grid cells,
+    //or whose CIE76 difference is less than matchValue in L*a*b* mode
+    if(matchMode == true)
+    {
+        //the stabilizer only follows the best match, a ranking also needs the runner-up
+        size = stable.mode ? 1 : rankSize + 1;
+
+        //reuse the last result while the sample stays within the cache epsilon
+        if(!lookupMatchCache(&matchCache, ledRed, ledGreen, ledBlue, size, &matches))
+        {
+            PROFILE_BEGIN(PROBE_MATCH);
+
+            findMatches(size);
+            sortRanking(&matches);
+            storeMatchCache(&matchCache, ledRed, ledGreen, ledBlue, size, &matches);
+
+            PROFILE_END(PROBE_MATCH);
+        }
+
+        //when stabilized only report changes of the best match, and nothing else
+        if(stable.mode)
+        {
+            quiet = true;
+
+            if(updateStabilizer(&stable, (matches.count > 0) ? matches.entry[0].index : STABLE_NONE))
+            {
+                printStableState();
+                emitted = true;
+            }
+        }
+        else
+        {
+            printRanking(&matches, (matchMetric == MATCH_LAB) ? LAB_SHIFT : 0, sampleTime);
+            emitted = (matches.count > 0);
+        }
+    }
+
+    // The blink task turns the status LED off again, the sample does not wait
+    if(sampleLed)
+    {
+        setPinValue(GREEN_LED, 1);
+        startTaskTimer(&scheduler, &blinkTimer, TASK_BLINK, SAMPLE_BLINK / TASK_TICK, 0);
+    }
+
+    //If in delta mode and change in r,g,b is greater than deltaValue then print new values
+    if(!quiet && delta.mode == true && delta.difference > delta.value)
+    {
+        //print raw results in comparison
+        sendUart0String("  ");
+        sendUart0Stamp(sampleTime, ',');
+        sendUart0Triplet(ledRed, ledGreen, ledBlue);
+        sendUart0String("\r\n");
+        emitted = true;
+    }
+    //if not in delta mode print measured values
+    else if(!quiet && !delta.mode)
+    {
+        //print raw results in comparison
+        sendUart0String("  ");
+        sendUart0Stamp(sampleTime, ',');
+        sendUart0Triplet(ledRed, ledGreen, ledBlue);
+        sendUart0String("\r\n");
+        emitted = true;
+    }
+
+    if(emitted)
+    {
+        COUNT_STAT(STAT_EMITTED);
+    }
+
+    PROFILE_END(PROBE_REPORT);
+}
+
+//Function to call when needing to measure for trigger and button commands
+void getMeasurement(void)
+{
+    if(validCalibration == true)
+    {
+        PROFILE_BEGIN(PROBE_MEASURE);
+
+        measureRgb();
+        reportMeasurement();
+
+        PROFILE_END(PROBE_MEASURE);
+    }
+    else
+    {
+        sendUart0String("  No calibration performed.\r\n");
+    }
+}
+
+//return measured value in the range of 0... 255 using
+// m = (m/th)*(tMax-tMin), where th = threshold, tMax
+//and tMin is target max and min, and m = measured value
+int normalizeRgbColor(int measurement)
+{
+    int temp;
+
+    if(threshold <= 0)
+    {
+        return 255;
+    }
+
+    temp = (measurement * 255) / threshold;
+
+    if(temp > 255)
+    {
+        temp = 255;
+    }
+
+    return temp;
+}
+
+//function to set the delta value for displaying measured values when greater than D
+void deltaD(void)
+{
+    float avg = 0.0;
+
+    PROFILE_BEGIN(PROBE_DELTA);
+
+    delta.methodResult = sqrt((ledRed * ledRed) + (ledGreen * ledGreen) + (ledBlue * ledBlue));
+    delta.sum -= delta.methodValues[delta.index];
+    delta.sum += delta.methodResult;
+    delta.methodValues[delta.index] = delta.methodResult;
+    delta.index = ++delta.index % 16;
+
+    avg = 0.9*(delta.sum/16) + (0.1 * delta.methodResult);
+    delta.difference = abs((int)delta.methodResult - (int)avg);
+
+    PROFILE_END(PROBE_DELTA);
+}
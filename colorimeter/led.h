@@ -1,70 +1,85 @@
-// led.h
-// William Bozarth
-// Created on: October 8, 2020
-
-//-----------------------------------------------------------------------------
-// Hardware Target
-//-----------------------------------------------------------------------------
-
-// Target Platform: EK-TM4C123GXL Evaluation Board
-// Target uC:       TM4C123GH6PM
-// System Clock:    40 MHz
-
-#ifndef LED_H_
-#define LED_H_
-
-#include <stdint.h>
-#include <stdbool.h>
-#include "led.h"
-
-//
-// Includes and Defines
-#define RAMP_SPEED 20000
-#define DELTA_MAX  500000
-#define GREEN_LED PORTF,3
-
-extern bool sampleLed;
-
-//----- Trigger Variables ---------------
-extern uint16_t ledRed;
-extern uint16_t ledGreen;
-extern uint16_t ledBlue;
-
-//------- Test Variables ---------------
-extern uint16_t redLedCal[1024];
-extern uint16_t greenLedCal[1024];
-extern uint16_t blueLedCal[1024];
-extern uint16_t rgbLeds[3];
-extern bool validTest;
-extern bool printTest;
-
-//-------- match E Variables ------------
-extern uint8_t matchValue;
-extern float eColor;
-extern bool matchMode;
-extern bool match;
-extern bool testMode;
-
-typedef struct _DELTA_MODE {
-    bool mode;
-    float methodResult;
-    float methodValues[16];
-    float sum;
-    int index;
-    int difference;
-    int value;
-} DELTA_MODE;
-
-extern DELTA_MODE delta;
-
-uint16_t getRgbValue(char * buffer);
-void testLED(void);
-void calibrateLed(int threshold);
-void getMeasurement(void);
-void setTriplet(void);
-int normalizeRgbColor(int measurement);
-void deltaD(void);
-void euclidNorm(void);
-void rampLed(uint16_t ledCal[], uint16_t leds[], uint8_t setLed);
-
-#endif /* LED_H_ */
+// led.h
+// William Bozarth
+// Created on: October 8, 2020
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#ifndef LED_H_
+#define LED_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "led.h"
+
+//
+// Includes and Defines
+#define RAMP_SPEED 20000
+#define DELTA_MAX  500000
+#define RAMP_CSV   0
+#define RAMP_DELTA 1
+#define GREEN_LED PORTF,3
+#define PUSH_BUTTON PORTF,4
+#define SETTLE_TIME        20000                 // us for the sensor to follow each LED
+#define MIN_SETTLE_TIME    500
+#define MAX_SETTLE_TIME    100000
+#define SAMPLE_BLINK       10000                 // us the status LED stays on after a sample
+#define MEASUREMENT_MARGIN 2000                  // us for matching and the report
+
+extern bool sampleLed;
+
+//----- Trigger Variables ---------------
+extern uint32_t settleTime;
+extern uint16_t ledRed;
+extern uint16_t ledGreen;
+extern uint16_t ledBlue;
+extern uint64_t sampleTime;                      // us since boot at the first capture
+
+//------- Test Variables ---------------
+extern uint16_t redLedCal[1024];
+extern uint16_t greenLedCal[1024];
+extern uint16_t blueLedCal[1024];
+extern uint16_t rgbLeds[3];
+extern uint16_t rampLength[3];
+extern bool validTest;
+extern bool printTest;
+extern uint8_t rampFormat;
+
+//-------- match E Variables ------------
+extern uint8_t matchValue;
+extern bool matchMode;
+extern bool match;
+extern bool testMode;
+
+typedef struct _DELTA_MODE {
+    bool mode;
+    float methodResult;
+    float methodValues[16];
+    float sum;
+    int index;
+    int difference;
+    int value;
+} DELTA_MODE;
+
+extern DELTA_MODE delta;
+
+void testLED(void);
+void calibrateLed(int threshold);
+void measureRgb(void);
+void startMeasurement(uint32_t settle, void (*done)(void));
+uint32_t measurementTime(void);
+void endSampleBlink(void);
+void reportMeasurement(void);
+void getMeasurement(void);
+void setTriplet(void);
+int normalizeRgbColor(int measurement);
+void deltaD(void);
+void rampLed(uint16_t ledCal[], uint16_t leds[], uint8_t setLed);
+void printRampTable(void);
+
+#endif /* LED_H_ */
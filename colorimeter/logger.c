@@ -0,0 +1,450 @@
+// logger.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+// Measurement log in the flash above the program (see logger.h for the
+// format). Record bytes are gathered into a word in RAM and each word is
+// programmed once, so a power cut loses at most the last three bytes. When the
+// ring is full the oldest page is erased and reused. A boot always starts a
+// new page, since the clock restarts from zero.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "uart0.h"
+#include "format.h"
+#include "flash.h"
+#include "logger.h"
+
+#define VARINT_BYTES       5
+
+bool logMode = false;
+LOG_STATS logStats = {0};
+
+// Write position, word == LOG_PAGE_WORDS when no page is open
+static uint32_t head;
+static uint32_t sequence;
+static uint32_t usedPages;
+static uint16_t word = LOG_PAGE_WORDS;
+static uint32_t pending;
+static uint8_t pendingBytes;
+
+// Encoder state, the previous sample of the open page
+static uint32_t lastTime;
+static uint32_t lastInterval;
+static uint8_t lastColor[3];
+
+// Returns the address of a page of the log
+static uint32_t pageAddress(uint32_t page)
+{
+    return LOG_START + (page * FLASH_PAGE_SIZE);
+}
+
+// Returns true if the page carries a header, with its sequence number
+static bool readPageHeader(uint32_t page, uint32_t* pageSequence)
+{
+    uint32_t header = readFlashWord(pageAddress(page));
+
+    *pageSequence = header & LOG_SEQUENCE_MASK;
+
+    return (header >> 24) == LOG_MAGIC;
+}
+
+// Returns true if every word of the page is erased
+static bool pageErased(uint32_t page)
+{
+    uint16_t i;
+
+    for(i = 0; i < LOG_PAGE_WORDS; i++)
+    {
+        if(readFlashWord(pageAddress(page) + (i * 4)) != FLASH_ERASED)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Returns a byte of a page
+static uint8_t readPageByte(uint32_t page, uint16_t index)
+{
+    return readFlashWord(pageAddress(page) + (index & ~3)) >> ((index & 3) * 8);
+}
+
+// Map a signed delta to an unsigned value, small magnitudes to small values
+static uint32_t zigzag(int32_t value)
+{
+    return (value < 0) ? ~((uint32_t)value << 1) : ((uint32_t)value << 1);
+}
+
+static int32_t unzigzag(uint32_t value)
+{
+    return (value & 1) ? (int32_t)~(value >> 1) : (int32_t)(value >> 1);
+}
+
+// Append value seven bits at a time, low bits first, returns the new length
+static uint8_t putVarint(uint8_t buffer[], uint8_t length, uint32_t value)
+{
+    while(value >= 0x80)
+    {
+        buffer[length++] = (value & 0x7F) | 0x80;
+        value >>= 7;
+    }
+
+    buffer[length++] = value;
+
+    return length;
+}
+
+// Read a varint that must end before end, returns false if it does not
+static bool readVarint(uint32_t page, uint16_t* index, uint16_t end, uint32_t* value)
+{
+    uint8_t i, byte;
+
+    *value = 0;
+
+    for(i = 0; i < VARINT_BYTES && *index < end; i++)
+    {
+        byte = readPageByte(page, (*index)++);
+        *value |= (uint32_t)(byte & 0x7F) << (i * 7);
+
+        if(!(byte & 0x80))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Encode a sample against the previous one of the open page
+static uint8_t encodeRecord(uint8_t buffer[], uint32_t time, const uint8_t color[])
+{
+    uint32_t interval = time - lastTime;
+    uint8_t length = 1, i;
+
+    buffer[0] = 0;
+
+    for(i = 0; i < 3; i++)
+    {
+        if(color[i] != lastColor[i])
+        {
+            buffer[0] |= LOG_TAG_RED << i;
+            length = putVarint(buffer, length, zigzag((int32_t)color[i] - lastColor[i]));
+        }
+    }
+
+    if(interval != lastInterval)
+    {
+        buffer[0] |= LOG_TAG_INTERVAL;
+        length = putVarint(buffer, length, zigzag((int32_t)(interval - lastInterval)));
+    }
+
+    return length;
+}
+
+// Gather a byte into the pending word, programming it once full
+static bool putByte(uint8_t byte)
+{
+    bool ok = true;
+
+    pending |= (uint32_t)byte << (pendingBytes * 8);
+
+    if(++pendingBytes == 4)
+    {
+        ok = writeFlashWord(pageAddress(head) + (word * 4), pending);
+        word++;
+        pending = 0;
+        pendingBytes = 0;
+    }
+
+    return ok;
+}
+
+// Returns the record bytes still free in the open page
+static uint16_t freeBytes(void)
+{
+    return ((LOG_PAGE_WORDS - word) * 4) - pendingBytes;
+}
+
+// Start the next page of the ring with a sample time of time, erasing the
+// oldest page when the ring is full
+static bool openPage(uint32_t time)
+{
+    uint32_t next = (head + 1) % LOG_PAGES, nextSequence;
+    bool ok = true;
+
+    if(!readPageHeader(next, &nextSequence))
+    {
+        usedPages++;
+    }
+
+    if(!pageErased(next))
+    {
+        ok = eraseFlashPage(pageAddress(next));
+        logStats.erases++;
+    }
+
+    head = next;
+    sequence = (sequence + 1) & LOG_SEQUENCE_MASK;
+    ok = ok && writeFlashWord(pageAddress(head), ((uint32_t)LOG_MAGIC << 24) | sequence);
+    ok = ok && writeFlashWord(pageAddress(head) + 4, time);
+    word = ok ? LOG_HEADER_WORDS : LOG_PAGE_WORDS;
+    pending = 0;
+    pendingBytes = 0;
+
+    lastTime = time;
+    lastInterval = 0;
+    lastColor[0] = lastColor[1] = lastColor[2] = 0;
+
+    return ok;
+}
+
+// Find the newest page. Nothing is read from it, the next sample opens a
+// new page.
+void mountLog(void)
+{
+    uint32_t page, pageSequence;
+    bool found = false;
+
+    head = LOG_PAGES - 1;
+    sequence = LOG_SEQUENCE_MASK;
+    usedPages = 0;
+
+    for(page = 0; page < LOG_PAGES; page++)
+    {
+        if(readPageHeader(page, &pageSequence))
+        {
+            usedPages++;
+
+            if(!found || pageSequence > sequence)
+            {
+                head = page;
+                sequence = pageSequence;
+                found = true;
+            }
+        }
+    }
+
+    word = LOG_PAGE_WORDS;
+    pending = 0;
+    pendingBytes = 0;
+}
+
+// Erase every page in use and start over from the first page
+void clearLog(void)
+{
+    uint32_t page;
+
+    for(page = 0; page < LOG_PAGES; page++)
+    {
+        if(readFlashWord(pageAddress(page)) != FLASH_ERASED)
+        {
+            eraseFlashPage(pageAddress(page));
+            logStats.erases++;
+        }
+    }
+
+    head = LOG_PAGES - 1;
+    sequence = LOG_SEQUENCE_MASK;
+    usedPages = 0;
+    word = LOG_PAGE_WORDS;
+    pending = 0;
+    pendingBytes = 0;
+}
+
+// Append a sample taken at time ms since boot. Samples that do not fit the
+// open page go first in a new one.
+bool logSample(uint32_t time, uint16_t red, uint16_t green, uint16_t blue)
+{
+    uint8_t buffer[LOG_RECORD_BYTES], length, i;
+    uint8_t color[3] = {red, green, blue};
+    bool ok = true;
+
+    if(word == LOG_PAGE_WORDS)
+    {
+        ok = openPage(time);
+    }
+
+    length = encodeRecord(buffer, time, color);
+
+    if(ok && length > freeBytes())
+    {
+        flushLog();
+        ok = openPage(time);
+        length = encodeRecord(buffer, time, color);
+    }
+
+    for(i = 0; ok && i < length; i++)
+    {
+        ok = putByte(buffer[i]);
+    }
+
+    if(!ok)
+    {
+        // Give up on the page, the next sample opens another
+        word = LOG_PAGE_WORDS;
+        logStats.failures++;
+        return false;
+    }
+
+    lastInterval = time - lastTime;
+    lastTime = time;
+    lastColor[0] = color[0];
+    lastColor[1] = color[1];
+    lastColor[2] = color[2];
+
+    logStats.samples++;
+    logStats.bytes += length;
+
+    return true;
+}
+
+// Program the pending bytes padded with LOG_TAG_PAD, so everything logged so
+// far can be read back. Logging goes on in the next word.
+void flushLog(void)
+{
+    while(pendingBytes > 0)
+    {
+        putByte(LOG_TAG_PAD);
+    }
+}
+
+// Decode one page, returns the number of samples passed to visitor. A bad
+// tag or a record cut short ends the page.
+static uint32_t readPage(uint32_t page, LOG_VISITOR visitor)
+{
+    uint16_t index = LOG_HEADER_WORDS * 4;
+    uint32_t time = readFlashWord(pageAddress(page) + 4), interval = 0, delta, count = 0;
+    uint8_t color[3] = {0, 0, 0}, tag, i;
+    bool ok = true;
+
+    while(ok && index < FLASH_PAGE_SIZE)
+    {
+        tag = readPageByte(page, index++);
+
+        if(tag == LOG_TAG_PAD)
+        {
+            index = (index + 3) & ~3;
+            continue;
+        }
+
+        if(tag & ~(LOG_TAG_RED | LOG_TAG_GREEN | LOG_TAG_BLUE | LOG_TAG_INTERVAL))
+        {
+            break;
+        }
+
+        for(i = 0; ok && i < 3; i++)
+        {
+            if(tag & (LOG_TAG_RED << i))
+            {
+                ok = readVarint(page, &index, FLASH_PAGE_SIZE, &delta);
+                color[i] += unzigzag(delta);
+            }
+        }
+
+        if(ok && (tag & LOG_TAG_INTERVAL))
+        {
+            ok = readVarint(page, &index, FLASH_PAGE_SIZE, &delta);
+            interval += unzigzag(delta);
+        }
+
+        if(ok)
+        {
+            time += interval;
+            visitor(time, color[0], color[1], color[2]);
+            count++;
+        }
+    }
+
+    return count;
+}
+
+// Pass every logged sample to visitor, oldest first, returns the count.
+// Pages after the head in the ring are the oldest.
+uint32_t readLog(LOG_VISITOR visitor)
+{
+    uint32_t i, page, pageSequence, count = 0;
+
+    for(i = 1; i <= LOG_PAGES; i++)
+    {
+        page = (head + i) % LOG_PAGES;
+
+        if(readPageHeader(page, &pageSequence))
+        {
+            count += readPage(page, visitor);
+        }
+    }
+
+    return count;
+}
+
+// Print one sample as a CSV line
+static void dumpSample(uint32_t time, uint8_t red, uint8_t green, uint8_t blue)
+{
+    sendUart0String("  log,");
+    sendUart0Unsigned(time);
+    sendUart0String(",");
+    sendUart0Unsigned(red);
+    sendUart0String(",");
+    sendUart0Unsigned(green);
+    sendUart0String(",");
+    sendUart0Unsigned(blue);
+    sendUart0String("\r\n");
+}
+
+// Stream the whole log as "log,TIME,R,G,B" lines, time in ms since the boot
+// that logged it
+void dumpLog(void)
+{
+    uint32_t count;
+
+    flushLog();
+    count = readLog(dumpSample);
+
+    sendUart0String("  ");
+    sendUart0Unsigned(count);
+    sendUart0String(" samples dumped\r\n");
+}
+
+// Print usage of the log region and the compression achieved this boot
+void printLog(void)
+{
+    sendUart0String(logMode ? "  log on, " : "  log off, ");
+    sendUart0Unsigned(usedPages);
+    sendUart0String(" of ");
+    sendUart0Unsigned(LOG_PAGES);
+    sendUart0String(" pages used, ");
+    sendUart0Unsigned(logStats.samples);
+    sendUart0String(" samples in ");
+    sendUart0Unsigned(logStats.bytes);
+    sendUart0String(" bytes");
+
+    if(logStats.samples > 0)
+    {
+        sendUart0String(", ");
+        sendUart0Fixed((logStats.bytes * 100 + (logStats.samples >> 1)) / logStats.samples, 2);
+        sendUart0String(" bytes/sample");
+    }
+
+    sendUart0String(", ");
+    sendUart0Unsigned(logStats.erases);
+    sendUart0String(" erases");
+
+    if(logStats.failures > 0)
+    {
+        sendUart0String(", ");
+        sendUart0Unsigned(logStats.failures);
+        sendUart0String(" samples lost");
+    }
+
+    sendUart0String("\r\n");
+}
@@ -0,0 +1,79 @@
+// logger.h
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#ifndef LOGGER_H_
+#define LOGGER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "flash.h"
+
+//
+// Defines
+//
+
+// Bounds of the log region, set in tm4c123gh6pm.cmd
+extern uint8_t __LOG_START[];
+extern uint8_t __LOG_END[];
+
+// The log is a ring of flash pages filled in order. A page starts with a
+// header word, bits 31..24 LOG_MAGIC and bits 23..0 a sequence number, and
+// the time of its first sample in ms. Records follow as a byte stream: a tag
+// byte saying which fields changed, then each changed field as a zigzag
+// varint delta. The first record of a page is a delta from time zero and
+// black, so every page decodes on its own.
+#define LOG_START            ((uint32_t)__LOG_START)
+#define LOG_PAGES            ((uint32_t)(__LOG_END - __LOG_START) / FLASH_PAGE_SIZE)
+#define LOG_PAGE_WORDS       (FLASH_PAGE_SIZE / 4)
+#define LOG_HEADER_WORDS     2
+#define LOG_MAGIC            0x4C
+#define LOG_SEQUENCE_MASK    0x00FFFFFF
+#define LOG_RECORD_BYTES     12                  // tag, 3 x 2 color bytes, 5 interval bytes
+
+// Tag bits, a field without its bit repeats the previous value. The
+// interval is the time since the previous sample, so a steady periodic
+// sample of an unchanged color is a single byte.
+#define LOG_TAG_RED          0x01
+#define LOG_TAG_GREEN        0x02
+#define LOG_TAG_BLUE         0x04
+#define LOG_TAG_INTERVAL     0x08
+#define LOG_TAG_PAD          0xFF                // rest of the word is unused
+
+typedef void (*LOG_VISITOR)(uint32_t time, uint8_t red, uint8_t green, uint8_t blue);
+
+// Counters since boot
+typedef struct _LOG_STATS
+{
+    uint32_t samples;
+    uint32_t bytes;                             // record bytes, padding excluded
+    uint32_t erases;
+    uint32_t failures;                          // samples lost to flash errors
+} LOG_STATS;
+
+//
+// Global Variables
+//
+extern bool logMode;
+extern LOG_STATS logStats;
+
+//
+// Definitions
+//
+void mountLog(void);
+void clearLog(void);
+bool logSample(uint32_t time, uint16_t red, uint16_t green, uint16_t blue);
+void flushLog(void);
+uint32_t readLog(LOG_VISITOR visitor);
+void dumpLog(void);
+void printLog(void);
+
+#endif /* LOGGER_H_ */
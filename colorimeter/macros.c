@@ -0,0 +1,237 @@
+// macros.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+// Macros stay out of the journal in blocks of their own. A block is only
+// written when the user defines or erases a macro, and only the words that
+// change, so it is rewritten in place rather than wear leveled. A power cut
+// part way through leaves a block whose check word does not match: it is
+// shown as corrupt and never run, until the macro is defined again or erased.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "uart0.h"
+#include "eeprom.h"
+#include "macros.h"
+
+// Returns EEPROM address of first word of macro slot
+static uint16_t macroAddress(uint8_t slot)
+{
+    return (MACRO_BLOCK + slot) * EEPROM_BLOCK_WORDS;
+}
+
+// Unpack words into a NULL terminated string
+static void unpackString(const uint32_t words[], char str[], uint8_t count)
+{
+    uint8_t i, j;
+
+    for(i = 0; i < count; i++)
+    {
+        for(j = 0; j < 4; j++)
+        {
+            str[(4 * i) + j] = (words[i] >> (8 * j)) & 0xFF;
+        }
+    }
+
+    str[4 * count] = '\0';
+}
+
+// Pack a string 4 characters per word, padding with NULL
+static void packString(uint32_t words[], const char str[], uint8_t count)
+{
+    uint8_t i, j, length = strlen(str);
+
+    for(i = 0; i < count; i++)
+    {
+        words[i] = 0;
+
+        for(j = 0; j < 4; j++)
+        {
+            if((4 * i) + j < length)
+            {
+                words[i] |= (uint32_t)(uint8_t)str[(4 * i) + j] << (8 * j);
+            }
+        }
+    }
+}
+
+// Returns the check word of a macro block, a CRC-16-CCITT of its name and
+// body words
+static uint32_t macroCheck(const uint32_t block[])
+{
+    uint16_t crc = 0xFFFF;
+    uint8_t i, bit;
+
+    for(i = 0; i < MACRO_CHECK_WORD; i++)
+    {
+        for(bit = 32; bit > 0; bit--)
+        {
+            crc = (((crc >> 15) ^ (block[i] >> (bit - 1))) & 1) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+
+    return MACRO_MAGIC | crc;
+}
+
+// Read the block of a macro slot, returns true if its check word matches
+static bool readMacro(uint8_t slot, uint32_t block[])
+{
+    readEepromWords(macroAddress(slot), block, EEPROM_BLOCK_WORDS);
+
+    return block[MACRO_CHECK_WORD] == macroCheck(block);
+}
+
+// Returns slot holding macro name, or -1 if macro is not stored. A corrupt
+// macro is found by its name too, so it can be defined again or erased.
+static int8_t findMacro(const char name[])
+{
+    uint8_t slot;
+    uint32_t block[EEPROM_BLOCK_WORDS];
+    char stored[MACRO_NAME_LENGTH + 1];
+
+    for(slot = 0; slot < MAX_MACROS; slot++)
+    {
+        if(readEeprom(macroAddress(slot)) != 0xFFFFFFFF)
+        {
+            readMacro(slot, block);
+            unpackString(block, stored, MACRO_NAME_WORDS);
+
+            if(strcmp(name, stored) == 0)
+            {
+                return slot;
+            }
+        }
+    }
+
+    return -1;
+}
+
+// Store macro in EEPROM, an empty body erases the macro. Returns false if the
+// name or body is too long or every slot is in use. Words that already hold
+// their value are not written again, the check word goes last.
+bool storeMacro(const char name[], const char body[])
+{
+    int8_t slot;
+    uint8_t i;
+    uint32_t block[EEPROM_BLOCK_WORDS];
+
+    if(strlen(name) > MACRO_NAME_LENGTH || strlen(body) > MACRO_BODY_LENGTH)
+    {
+        return false;
+    }
+
+    slot = findMacro(name);
+
+    if(body[0] == '\0')
+    {
+        for(i = 0; slot >= 0 && i < EEPROM_BLOCK_WORDS; i++)
+        {
+            writeEeprom(macroAddress(slot) + i, 0xFFFFFFFF);
+        }
+
+        return true;
+    }
+
+    // Use first free slot for a new macro
+    for(i = 0; slot < 0 && i < MAX_MACROS; i++)
+    {
+        if(readEeprom(macroAddress(i)) == 0xFFFFFFFF)
+        {
+            slot = i;
+        }
+    }
+
+    if(slot < 0)
+    {
+        return false;
+    }
+
+    packString(block, name, MACRO_NAME_WORDS);
+    packString(&block[MACRO_NAME_WORDS], body, MACRO_BODY_WORDS);
+    block[MACRO_CHECK_WORD] = macroCheck(block);
+
+    for(i = 0; i < EEPROM_BLOCK_WORDS; i++)
+    {
+        if(readEeprom(macroAddress(slot) + i) != block[i])
+        {
+            writeEeprom(macroAddress(slot) + i, block[i]);
+        }
+    }
+
+    return true;
+}
+
+// Copy command text of macro into body, which must hold MACRO_BODY_LENGTH + 1
+// characters. Returns false if macro is not stored. A corrupt macro is
+// reported and comes back with no commands.
+bool loadMacro(const char name[], char body[])
+{
+    int8_t slot = findMacro(name);
+    uint32_t block[EEPROM_BLOCK_WORDS];
+
+    if(slot < 0)
+    {
+        return false;
+    }
+
+    if(readMacro(slot, block))
+    {
+        unpackString(&block[MACRO_NAME_WORDS], body, MACRO_BODY_WORDS);
+    }
+    else
+    {
+        body[0] = '\0';
+        sendUart0String("  Macro corrupt, define it again.\r\n");
+    }
+
+    return true;
+}
+
+// Displays all stored macros for user
+void printMacros(void)
+{
+    uint8_t slot;
+    bool none = true, valid;
+    uint32_t block[EEPROM_BLOCK_WORDS];
+    char buffer[MACRO_BODY_LENGTH + 1];
+
+    for(slot = 0; slot < MAX_MACROS; slot++)
+    {
+        if(readEeprom(macroAddress(slot)) != 0xFFFFFFFF)
+        {
+            valid = readMacro(slot, block);
+
+            unpackString(block, buffer, MACRO_NAME_WORDS);
+            sendUart0String("  ");
+            sendUart0String(buffer);
+
+            if(valid)
+            {
+                unpackString(&block[MACRO_NAME_WORDS], buffer, MACRO_BODY_WORDS);
+                sendUart0String(" = ");
+                sendUart0String(buffer);
+                sendUart0String("\r\n");
+            }
+            else
+            {
+                sendUart0String(" is corrupt, define it again\r\n");
+            }
+
+            none = false;
+        }
+    }
+
+    if(none)
+    {
+        sendUart0String("  NO macros stored.\r\n");
+    }
+}
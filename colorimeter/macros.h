@@ -0,0 +1,42 @@
+// macros.h
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#ifndef MACROS_H_
+#define MACROS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "eeprom.h"
+
+//
+// Defines
+//
+
+// Each macro uses one EEPROM block: 2 words of name followed by 13 words of
+// command text, packed 4 characters per word and padded with NULL('\0'), then
+// a check word, MACRO_MAGIC with a CRC-16 of the other words in bits 15..0
+#define MACRO_NAME_WORDS  2
+#define MACRO_BODY_WORDS  (EEPROM_BLOCK_WORDS - MACRO_NAME_WORDS - 1)
+#define MACRO_CHECK_WORD  (EEPROM_BLOCK_WORDS - 1)
+#define MACRO_NAME_LENGTH (4 * MACRO_NAME_WORDS)
+#define MACRO_BODY_LENGTH (4 * MACRO_BODY_WORDS)
+#define MACRO_MAGIC       0x4D430000
+#define MAX_MACRO_DEPTH   2
+
+//
+// Definitions
+//
+bool storeMacro(const char name[], const char body[]);
+bool loadMacro(const char name[], char body[]);
+void printMacros(void);
+
+#endif /* MACROS_H_ */
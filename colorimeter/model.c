@@ -0,0 +1,145 @@
+// model.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+// Statistical color classes. A reference learned from several samples keeps
+// the per-channel standard deviation next to its mean, and samples are scored
+// by their Mahalanobis distance (diagonal covariance) from the class.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "eeprom.h"
+#include "model.h"
+
+// Chi-square survival function for 3 degrees of freedom in percent, sampled
+// at D^2 = i/4. Gives the chance a sample of the class lies at least this far.
+static const uint8_t confidenceTable[64] =
+{
+    100,  97,  92,  86,  80,  74,  68,  63,  57,  52,  48,  43,  39,  35,  32,  29,
+     26,  24,  21,  19,  17,  15,  14,  12,  11,  10,   9,   8,   7,   6,   6,   5,
+      5,   4,   4,   3,   3,   3,   2,   2,   2,   2,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
+
+// Integer square root rounded to nearest
+static uint32_t squareRoot(uint32_t value)
+{
+    uint32_t root = 0, bit = (uint32_t)1 << 30;
+
+    while(bit > value)
+    {
+        bit >>= 2;
+    }
+
+    while(bit != 0)
+    {
+        if(value >= root + bit)
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return (value > root) ? root + 1 : root;
+}
+
+// Clear accumulated samples
+void resetColorStats(COLOR_STATS* stats)
+{
+    memset(stats, 0, sizeof(COLOR_STATS));
+}
+
+// Accumulate one sample
+void addColorSample(COLOR_STATS* stats, uint8_t red, uint8_t green, uint8_t blue)
+{
+    const uint8_t sample[3] = {red, green, blue};
+    uint8_t channel;
+
+    for(channel = 0; channel < 3; channel++)
+    {
+        stats->sum[channel] += sample[channel];
+        stats->sumSquares[channel] += sample[channel] * sample[channel];
+    }
+
+    stats->count++;
+}
+
+// Rounded mean of accumulated samples
+void getColorMean(const COLOR_STATS* stats, uint8_t mean[3])
+{
+    uint8_t channel;
+
+    for(channel = 0; channel < 3; channel++)
+    {
+        mean[channel] = (stats->count == 0) ? 0 : (stats->sum[channel] + (stats->count >> 1)) / stats->count;
+    }
+}
+
+// Returns packed class model, or 0 if fewer than two samples were taken
+uint16_t getColorModel(const COLOR_STATS* stats)
+{
+    uint16_t model = MODEL_VALID;
+    uint32_t n = stats->count, variance, sigma;
+    uint8_t channel;
+
+    if(n < 2)
+    {
+        return 0;
+    }
+
+    for(channel = 0; channel < 3; channel++)
+    {
+        // Sample variance in units of 1/4, so its root is sigma in units of 1/2
+        variance = ((4 * ((n * stats->sumSquares[channel]) - (stats->sum[channel] * stats->sum[channel]))) + ((n * (n - 1)) >> 1)) / (n * (n - 1));
+        sigma = squareRoot(variance);
+
+        if(sigma > MODEL_SIGMA_MAX)
+        {
+            sigma = MODEL_SIGMA_MAX;
+        }
+
+        model |= sigma << (MODEL_SIGMA_BITS * (2 - channel));
+    }
+
+    return model;
+}
+
+// Returns squared Mahalanobis distance in units of 1/256 between a sample and
+// a class with mean rgb. One count of sensor noise is added to each sigma so a
+// perfectly steady class does not divide by zero.
+uint32_t mahalanobisSquared(uint16_t model, uint32_t rgb, uint8_t red, uint8_t green, uint8_t blue)
+{
+    const int32_t difference[3] = {(int32_t)COLOR_RED(rgb) - red, (int32_t)COLOR_GREEN(rgb) - green, (int32_t)COLOR_BLUE(rgb) - blue};
+    uint32_t distance = 0, sigma;
+    uint8_t channel;
+
+    for(channel = 0; channel < 3; channel++)
+    {
+        sigma = MODEL_SIGMA(model, channel);
+        distance += ((uint32_t)(difference[channel] * difference[channel]) << 10) / ((sigma * sigma) + 4);
+    }
+
+    return distance;
+}
+
+// Returns confidence in percent that a sample at this distance belongs to the class
+uint8_t modelConfidence(uint32_t distanceSquared)
+{
+    uint32_t i = distanceSquared >> 6;
+
+    return (i < 64) ? confidenceTable[i] : 0;
+}
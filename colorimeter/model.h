@@ -0,0 +1,50 @@
+// model.h
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#ifndef MODEL_H_
+#define MODEL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//
+// Defines
+//
+
+// A color class model is packed in a halfword: bit 15 marks a model learned
+// from several samples, and bits 14..0 hold the red, green and blue standard
+// deviations in units of 1/2, 5 bits each
+#define MAX_SAMPLES       32
+#define MODEL_VALID       0x8000
+#define MODEL_SIGMA_BITS  5
+#define MODEL_SIGMA_MAX   ((1 << MODEL_SIGMA_BITS) - 1)
+#define MODEL_SIGMA(model, channel) (((model) >> (MODEL_SIGMA_BITS * (2 - (channel)))) & MODEL_SIGMA_MAX)
+#define MIN_CONFIDENCE    1                 // percent, classes below are not reported
+
+typedef struct _COLOR_STATS
+{
+    uint8_t  count;
+    uint32_t sum[3];
+    uint32_t sumSquares[3];
+} COLOR_STATS;
+
+//
+// Definitions
+//
+void resetColorStats(COLOR_STATS* stats);
+void addColorSample(COLOR_STATS* stats, uint8_t red, uint8_t green, uint8_t blue);
+void getColorMean(const COLOR_STATS* stats, uint8_t mean[3]);
+uint16_t getColorModel(const COLOR_STATS* stats);
+uint32_t mahalanobisSquared(uint16_t model, uint32_t rgb, uint8_t red, uint8_t green, uint8_t blue);
+uint8_t modelConfidence(uint32_t distanceSquared);
+
+#endif /* MODEL_H_ */
@@ -0,0 +1,134 @@
+// profile.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+// Hot path profiler. Each probe point keeps the count, min, max and total of
+// the cycles it measured with PROFILE_CLOCK(), the DWT cycle counter unless a
+// build names another (see profile.h).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "tm4c123gh6pm.h"
+#include "uart0.h"
+#include "format.h"
+#include "cycles.h"
+#include "profile.h"
+
+PROBE_STATS probeStats[MAX_PROBES] = {0};
+
+// Names in PROBE_ order, kept in flash
+static const char* const probeNames[MAX_PROBES] =
+{
+    "measure", "report", "match", "normalize", "delta", "channel", "uart isr"
+};
+
+// Cycles an empty probe measures, taken off every measurement
+static uint32_t probeOverhead = 0;
+
+// Clear every probe and measure what an empty probe costs
+void resetProfile(void)
+{
+    uint32_t state = _disable_interrupts();
+    uint32_t start = PROFILE_CLOCK();
+    uint8_t i;
+
+    probeOverhead = PROFILE_CLOCK() - start;
+
+    for(i = 0; i < MAX_PROBES; i++)
+    {
+        probeStats[i].count = 0;
+        probeStats[i].min = 0xFFFFFFFF;
+        probeStats[i].max = 0;
+        probeStats[i].total = 0;
+    }
+
+    _restore_interrupts(state);
+}
+
+// Add a measurement to a probe, from any context
+void recordProbe(uint8_t probe, uint32_t cycles)
+{
+    PROBE_STATS* stats = &probeStats[probe];
+    uint32_t state;
+
+    cycles = (cycles > probeOverhead) ? cycles - probeOverhead : 0;
+
+    state = _disable_interrupts();
+
+    stats->count++;
+    stats->total += cycles;
+
+    if(cycles < stats->min)
+    {
+        stats->min = cycles;
+    }
+
+    if(cycles > stats->max)
+    {
+        stats->max = cycles;
+    }
+
+    _restore_interrupts(state);
+}
+
+// Print the probes that were hit, in cycles with the mean also in us
+void printProfile(void)
+{
+    PROBE_STATS stats;
+    uint32_t state, mean;
+    uint8_t i;
+    bool found = false;
+
+    for(i = 0; i < MAX_PROBES; i++)
+    {
+        // copy so a probe hit while printing cannot mix two measurements
+        state = _disable_interrupts();
+        stats = probeStats[i];
+        _restore_interrupts(state);
+
+        if(stats.count == 0)
+        {
+            continue;
+        }
+
+        mean = stats.total / stats.count;
+        found = true;
+
+        sendUart0String("  ");
+        sendUart0StringLiteral(probeNames[i]);
+        sendUart0String(": ");
+        sendUart0Unsigned(stats.count);
+        sendUart0String(" hits, min ");
+        sendUart0Unsigned(stats.min);
+        sendUart0String(", mean ");
+        sendUart0Unsigned(mean);
+        sendUart0String(", max ");
+        sendUart0Unsigned(stats.max);
+        sendUart0String(" cycles, mean ");
+
+        // hundredths of a us while they fit, whole us beyond
+        if(mean <= (0xFFFFFFFF / 100))
+        {
+            sendUart0Fixed((mean * 100) / CYCLES_PER_MICROSECOND, 2);
+        }
+        else
+        {
+            sendUart0Unsigned(cyclesToMicroseconds(mean));
+        }
+
+        sendUart0String(" us\r\n");
+    }
+
+    if(!found)
+    {
+        sendUart0String(PROFILING ? "  No probes hit.\r\n" : "  Profiling NOT built in.\r\n");
+    }
+}
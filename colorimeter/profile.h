@@ -0,0 +1,77 @@
+// profile.h
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cycles.h"
+
+//
+// Defines
+//
+
+// Build with PROFILING 0 to compile every probe out
+#ifndef PROFILING
+#define PROFILING          1
+#endif
+
+// Probe points, named in the same order by probeNames in profile.c
+#define PROBE_MEASURE      0                     // getMeasurement(), blocking sample
+#define PROBE_REPORT       1                     // reportMeasurement()
+#define PROBE_MATCH        2                     // match search on a cache miss
+#define PROBE_NORMALIZE    3                     // normalizeRgbColor()
+#define PROBE_DELTA        4                     // deltaD()
+#define PROBE_CHANNEL      5                     // alarm reading a channel
+#define PROBE_UART_ISR     6                     // uart0Isr()
+#define MAX_PROBES         7
+
+// Function every probe reads its cycles from. A build can name its own, such
+// as a host test stepping a simulated counter.
+#ifndef PROFILE_CLOCK
+#define PROFILE_CLOCK      readCycleCounter
+#endif
+
+// Time the code between PROFILE_BEGIN(probe) and PROFILE_END(probe) in the
+// same block
+#if PROFILING
+#define PROFILE_BEGIN(probe) uint32_t probeStart##probe = PROFILE_CLOCK()
+#define PROFILE_END(probe)   recordProbe(probe, PROFILE_CLOCK() - probeStart##probe)
+#else
+#define PROFILE_BEGIN(probe)
+#define PROFILE_END(probe)
+#endif
+
+// Cycles spent in one probe, less the cost of the probe itself
+typedef struct _PROBE_STATS
+{
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+} PROBE_STATS;
+
+//
+// Global Variables
+//
+extern PROBE_STATS probeStats[MAX_PROBES];
+
+//
+// Definitions
+//
+uint32_t PROFILE_CLOCK(void);
+void resetProfile(void);
+void recordProbe(uint8_t probe, uint32_t cycles);
+void printProfile(void);
+
+#endif /* PROFILE_H_ */
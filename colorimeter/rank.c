@@ -0,0 +1,232 @@
+// rank.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+// Top-K selection of matching color references. Candidates are offered one at
+// a time to a fixed-size heap, so N references cost O(N log K), and the
+// survivors are reported best first as a single record.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "uart0.h"
+#include "format.h"
+#include "timestamp.h"
+#include "rank.h"
+
+uint8_t rankSize = 3;
+uint8_t rankFormat = RANK_TEXT;
+
+// Move entry i down until neither child is farther away, within count entries
+static void siftDown(RANK_ENTRY entry[], uint8_t i, uint8_t count)
+{
+    RANK_ENTRY temp;
+    uint8_t child;
+
+    while((child = (2 * i) + 1) < count)
+    {
+        if(child + 1 < count && entry[child + 1].distanceSquared > entry[child].distanceSquared)
+        {
+            child++;
+        }
+
+        if(entry[child].distanceSquared <= entry[i].distanceSquared)
+        {
+            break;
+        }
+
+        temp = entry[i];
+        entry[i] = entry[child];
+        entry[child] = temp;
+        i = child;
+    }
+}
+
+// Empty ranking that keeps at most size candidates
+void resetRanking(RANKING* ranking, uint8_t size)
+{
+    ranking->size = (size > MAX_RANK) ? MAX_RANK : size;
+    ranking->count = 0;
+}
+
+// Keep candidate if it is among the closest size offered so far
+void offerRanking(RANKING* ranking, uint16_t index, uint32_t distanceSquared, uint8_t confidence)
+{
+    RANK_ENTRY* entry = ranking->entry;
+    RANK_ENTRY temp;
+    uint8_t i, parent;
+
+    if(ranking->count < ranking->size)
+    {
+        // Sift the new entry up from the bottom of the heap
+        i = ranking->count++;
+        entry[i].index = index;
+        entry[i].confidence = confidence;
+        entry[i].distanceSquared = distanceSquared;
+
+        while(i > 0)
+        {
+            parent = (i - 1) >> 1;
+
+            if(entry[parent].distanceSquared >= entry[i].distanceSquared)
+            {
+                break;
+            }
+
+            temp = entry[i];
+            entry[i] = entry[parent];
+            entry[parent] = temp;
+            i = parent;
+        }
+    }
+    else if(ranking->size > 0 && distanceSquared < entry[0].distanceSquared)
+    {
+        // Replace the farthest kept candidate
+        entry[0].index = index;
+        entry[0].confidence = confidence;
+        entry[0].distanceSquared = distanceSquared;
+        siftDown(entry, 0, ranking->count);
+    }
+}
+
+// Heap sort the kept candidates in place, closest first. This consumes the
+// heap order, so the ranking must be reset before it is offered more.
+void sortRanking(RANKING* ranking)
+{
+    RANK_ENTRY temp;
+    uint8_t end;
+
+    for(end = ranking->count; end > 1; end--)
+    {
+        temp = ranking->entry[0];
+        ranking->entry[0] = ranking->entry[end - 1];
+        ranking->entry[end - 1] = temp;
+        siftDown(ranking->entry, 0, end - 1);
+    }
+}
+
+// Integer square root rounded down
+static uint32_t squareRoot(uint64_t value)
+{
+    uint64_t root = 0, bit = (uint64_t)1 << 62;
+
+    while(bit > value)
+    {
+        bit >>= 2;
+    }
+
+    while(bit != 0)
+    {
+        if(value >= root + bit)
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return root;
+}
+
+// Distance in tenths from a squared distance in units of 1/2^shift, rounded
+// to nearest. Twice the distance in tenths is sqrt(400 * distanceSquared), so
+// the rounding needs no fraction. A float root misrounds large distances.
+static uint32_t rankDistance(uint32_t distanceSquared, uint8_t shift)
+{
+    return (squareRoot((uint64_t)distanceSquared * 400) + (1 << shift)) >> (shift + 1);
+}
+
+// Print the first rankSize entries of a sorted ranking as one
+// record with the margin between the best and the runner-up. The ranking is
+// kept one entry longer than rankSize so the margin is known even for K = 1.
+// Nothing is printed when no reference matched. While stamps are on the
+// sample time follows the indent.
+//   text: "  match 3 12.4 (86%), 7 18.0, margin 5.6"
+//   csv:  "  match,2,5.6,3,12.4,86,7,18.0,"
+void printRanking(RANKING* ranking, uint8_t shift, uint64_t time)
+{
+    uint8_t i, shown;
+    uint32_t margin = 0;
+    RANK_ENTRY* entry = ranking->entry;
+
+    if(ranking->count == 0)
+    {
+        return;
+    }
+
+    shown = (ranking->count < rankSize) ? ranking->count : rankSize;
+
+    if(ranking->count > 1)
+    {
+        margin = rankDistance(entry[1].distanceSquared, shift) - rankDistance(entry[0].distanceSquared, shift);
+    }
+
+    if(rankFormat == RANK_CSV)
+    {
+        sendUart0String("  ");
+        sendUart0Stamp(time, ',');
+        sendUart0String("match,");
+        sendUart0Unsigned(shown);
+        sendUart0String(",");
+
+        // Margin is left empty without a runner-up
+        if(ranking->count > 1)
+        {
+            sendUart0Fixed(margin, 1);
+        }
+
+        for(i = 0; i < shown; i++)
+        {
+            sendUart0String(",");
+            sendUart0Unsigned(entry[i].index);
+            sendUart0String(",");
+            sendUart0Fixed(rankDistance(entry[i].distanceSquared, shift), 1);
+            sendUart0String(",");
+
+            if(entry[i].confidence != NO_CONFIDENCE)
+            {
+                sendUart0Unsigned(entry[i].confidence);
+            }
+        }
+    }
+    else
+    {
+        sendUart0String("  ");
+        sendUart0Stamp(time, ' ');
+        sendUart0String("match");
+
+        for(i = 0; i < shown; i++)
+        {
+            sendUart0String((i == 0) ? " " : ", ");
+            sendUart0Unsigned(entry[i].index);
+            sendUart0String(" ");
+            sendUart0Fixed(rankDistance(entry[i].distanceSquared, shift), 1);
+
+            if(entry[i].confidence != NO_CONFIDENCE)
+            {
+                sendUart0String(" (");
+                sendUart0Unsigned(entry[i].confidence);
+                sendUart0String("%)");
+            }
+        }
+
+        if(ranking->count > 1)
+        {
+            sendUart0String(", margin ");
+            sendUart0Fixed(margin, 1);
+        }
+    }
+
+    sendUart0String("\r\n");
+}
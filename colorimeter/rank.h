@@ -0,0 +1,57 @@
+// rank.h
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#ifndef RANK_H_
+#define RANK_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//
+// Defines
+//
+#define MAX_RANK      8                 // rankSize is at most MAX_RANK - 1
+#define RANK_TEXT     0
+#define RANK_CSV      1
+#define NO_CONFIDENCE 0xFF              // reference has no class model
+
+typedef struct _RANK_ENTRY
+{
+    uint16_t index;
+    uint8_t  confidence;
+    uint32_t distanceSquared;
+} RANK_ENTRY;
+
+// The best size candidates seen so far, kept as a max-heap on distance so the
+// worst of them is at entry[0] and a closer candidate replaces it in O(log K)
+typedef struct _RANKING
+{
+    uint8_t    size;
+    uint8_t    count;
+    RANK_ENTRY entry[MAX_RANK];
+} RANKING;
+
+//
+// Global Variables
+//
+extern uint8_t rankSize;
+extern uint8_t rankFormat;
+
+//
+// Definitions
+//
+void resetRanking(RANKING* ranking, uint8_t size);
+void offerRanking(RANKING* ranking, uint16_t index, uint32_t distanceSquared, uint8_t confidence);
+void sortRanking(RANKING* ranking);
+void printRanking(RANKING* ranking, uint8_t shift, uint64_t time);
+
+#endif /* RANK_H_ */
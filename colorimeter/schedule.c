@@ -0,0 +1,160 @@
+// schedule.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+// Deadline keeping for periodic samples. The timer ISR stamps each sample
+// with the us timestamp at its deadline, the timer timeout, and the sample
+// is stamped again when it ends. The cycle counter would not do, it stops
+// while the core sleeps between settles. A sample ending a period or more
+// after its deadline means the next timeout has already passed.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "uart0.h"
+#include "format.h"
+#include "led.h"
+#include "schedule.h"
+
+SCHEDULE schedule = {0};
+
+// Restart the counters for a new requested period in us
+void resetSchedule(SCHEDULE* schedule, uint32_t period)
+{
+    schedule->started = false;
+    schedule->requested = period;
+    schedule->period = period;
+    schedule->settle = settleTime;
+    schedule->longest = 0;
+    schedule->samples = 0;
+    schedule->overruns = 0;
+    schedule->skipped = 0;
+    schedule->adapted = 0;
+    schedule->elapsed = 0;
+}
+
+// Account for a sample due at us timestamp deadline that ended at end and
+// apply the overrun policy if it missed the next deadline. A stretch changes
+// schedule->period, which the caller programs. Degrading cuts
+// schedule->settle below settle, the configured settle time, and gives it
+// back as samples finish early enough; other policies keep it at settle.
+uint8_t checkSchedule(SCHEDULE* schedule, uint64_t deadline, uint64_t end, uint32_t settle)
+{
+    uint32_t duration = end - deadline, target, cut;
+
+    if(schedule->started)
+    {
+        schedule->elapsed += deadline - schedule->lastDeadline;
+    }
+
+    schedule->started = true;
+    schedule->lastDeadline = deadline;
+    schedule->samples++;
+
+    if(duration > schedule->longest)
+    {
+        schedule->longest = duration;
+    }
+
+    if(schedule->policy != OVERRUN_DEGRADE || schedule->settle > settle)
+    {
+        schedule->settle = settle;
+    }
+
+    target = schedule->period - (schedule->period >> SCHEDULE_SLACK);
+
+    if(duration < schedule->period)
+    {
+        // Give back half the spare time, split over the three settles, so
+        // the next sample still ends before the target
+        if(schedule->settle < settle && duration < target)
+        {
+            cut = (target - duration) / 6;
+            schedule->settle = (schedule->settle + cut < settle) ? schedule->settle + cut : settle;
+        }
+
+        return SCHEDULE_ON_TIME;
+    }
+
+    schedule->overruns++;
+    schedule->skipped += duration / schedule->period;
+
+    if(schedule->policy == OVERRUN_STRETCH)
+    {
+        schedule->period = duration + (duration >> SCHEDULE_SLACK);
+        schedule->adapted++;
+
+        return SCHEDULE_STRETCHED;
+    }
+
+    // Each sample settles three times, so the settle time takes a third of
+    // the cut needed to finish with slack to spare
+    if(schedule->policy == OVERRUN_DEGRADE && schedule->settle > MIN_SETTLE_TIME)
+    {
+        cut = ((duration - target) + 2) / 3;
+
+        schedule->settle = (schedule->settle > MIN_SETTLE_TIME + cut) ? schedule->settle - cut : MIN_SETTLE_TIME;
+        schedule->adapted++;
+
+        return SCHEDULE_DEGRADED;
+    }
+
+    return SCHEDULE_SKIPPED;
+}
+
+// Print the requested and achieved rates and the overrun counters
+void printSchedule(const SCHEDULE* schedule)
+{
+    static const char* policies[] = {"skip", "stretch", "degrade"};
+
+    sendUart0String("  period ");
+    sendUart0Unsigned(schedule->requested);
+    sendUart0String(" us requested");
+
+    if(schedule->period != schedule->requested)
+    {
+        sendUart0String(", ");
+        sendUart0Unsigned(schedule->period);
+        sendUart0String(" us running");
+    }
+
+    sendUart0String(", ");
+    sendUart0Fixed(schedule->requested ? 100000000 / schedule->requested : 0, 2);
+    sendUart0String(" Hz requested");
+
+    if(schedule->samples > 1 && schedule->elapsed > 0)
+    {
+        sendUart0String(", ");
+        sendUart0Fixed((uint32_t)(((uint64_t)(schedule->samples - 1) * 100000000) / schedule->elapsed), 2);
+        sendUart0String(" Hz achieved");
+    }
+
+    sendUart0String("\r\n  ");
+    sendUart0Unsigned(schedule->samples);
+    sendUart0String(" samples, longest ");
+    sendUart0Unsigned(schedule->longest);
+    sendUart0String(" us, ");
+    sendUart0Unsigned(schedule->overruns);
+    sendUart0String(" overruns, ");
+    sendUart0Unsigned(schedule->skipped);
+    sendUart0String(" deadlines skipped, ");
+    sendUart0Unsigned(schedule->adapted);
+    sendUart0String(" adapted, policy ");
+    sendUart0StringLiteral(policies[schedule->policy]);
+
+    if(schedule->settle < settleTime)
+    {
+        sendUart0String(", settle cut to ");
+        sendUart0Unsigned(schedule->settle);
+        sendUart0String(" us");
+    }
+
+    sendUart0String("\r\n");
+}
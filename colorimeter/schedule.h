@@ -0,0 +1,66 @@
+// schedule.h
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#ifndef SCHEDULE_H_
+#define SCHEDULE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//
+// Defines
+//
+
+// What is done when a sample runs past the next deadline. Every policy drops
+// the deadlines that were missed; they differ in what follows.
+#define OVERRUN_SKIP       0                     // keep the period
+#define OVERRUN_STRETCH    1                     // lengthen the period to fit
+#define OVERRUN_DEGRADE    2                     // shorten the settle time to fit, recover when there is room
+
+// Result of checking a sample against its deadline
+#define SCHEDULE_ON_TIME   0
+#define SCHEDULE_SKIPPED   1
+#define SCHEDULE_STRETCHED 2
+#define SCHEDULE_DEGRADED  3
+
+#define SCHEDULE_SLACK     3                     // adapted periods leave 1/8 of the period spare
+
+// Timing of the periodic samples since periodic sampling last started
+typedef struct _SCHEDULE
+{
+    uint8_t  policy;
+    bool     started;
+    uint32_t requested;                         // us
+    uint32_t period;                            // us, after any stretch
+    uint32_t settle;                            // us, settle time of periodic samples
+    uint64_t lastDeadline;                      // us timestamp, deadline of the last sample
+    uint32_t longest;                           // us, longest from a deadline to the sample end
+    uint32_t samples;
+    uint32_t overruns;                          // samples that ran past the next deadline
+    uint32_t skipped;                           // deadlines dropped
+    uint32_t adapted;                           // stretches or settle time cuts
+    uint64_t elapsed;                           // us from the first sample to the last
+} SCHEDULE;
+
+//
+// Global Variables
+//
+extern SCHEDULE schedule;
+
+//
+// Definitions
+//
+void resetSchedule(SCHEDULE* schedule, uint32_t period);
+uint8_t checkSchedule(SCHEDULE* schedule, uint64_t deadline, uint64_t end, uint32_t settle);
+void printSchedule(const SCHEDULE* schedule);
+
+#endif /* SCHEDULE_H_ */
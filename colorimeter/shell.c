@@ -1,176 +1,352 @@
-// shell.c
-// William Bozarth
-// Created on: October 7, 2020
-
-//-----------------------------------------------------------------------------
-// Hardware Target
-//-----------------------------------------------------------------------------
-
-// Target Platform: EK-TM4C123GXL Evaluation Board
-// Target uC:       TM4C123GH6PM
-// System Clock:    40 MHz
-
-#include <stdint.h>
-#include <stdbool.h>
-#include <stdlib.h>
-#include <string.h>
-#include "tm4c123gh6pm.h"
-#include "uart0.h"
-#include "shell.h"
-
-// Function to get Input from Terminal
-void getsUart0(USER_DATA* data)
-{
-    uint8_t count;
-    char c;
-
-    count = data->characterCount;
-
-    c = UART0_DR_R & 0xFF; // Get character
-
-    UART0_ICR_R = 0xFFF; // Clear any UART0 interrupts
-
-    // Determine if user input is complete
-    if((c == 13) || (count == QUEUE_BUFFER_LENGTH))
-    {
-        char buffer[10] = "\r\n";
-        data->buffer[count++] = '\0';
-        data->endOfString = true;
-        sendUart0String(buffer);
-    }
-    else if ((c == 8 || c == 127) && count > 0) // Decrement count if invalid character entered
-    {
-        count--;
-        data->characterCount = count;
-    }
-    else if (c >= ' ' && c < 127) // Converts capital letter to lower case (if necessary)
-    {
-        if('A' <= c && c <= 'Z')
-        {
-            data->buffer[count] = c + 32;
-        }
-        else
-        {
-            data->buffer[count] = c;
-        }
-    }
-}
-
-// Function to Tokenize Strings
-void parseFields(USER_DATA* data)
-{
-    char    c;
-    uint8_t count, fieldIndex;
-
-    count = data->characterCount;
-
-    c = data->buffer[count];
-
-    // Check if at end of user input and exit function if so.
-    if(c == '\0' || count > MAX_CHARS)
-        return;
-
-    // Get current Index for field arrays
-    fieldIndex = data->fieldCount;
-
-    if('a' <= c && c <= 'z') // Verify is character is an alpha (case sensitive)
-    {
-        if(data->delimeter)
-        {
-            data->fieldPosition[fieldIndex] = count;
-            data->fieldType[fieldIndex] = 'A';
-            data->fieldCount = ++fieldIndex;
-            data->delimeter = false;
-        }
-    }
-    else if(('0' <= c && c <= '9') || ',' == c ||  c == '.') //Code executes for numerics same as alpha
-    {
-        if(data->delimeter)
-        {
-            data->fieldPosition[fieldIndex] = count;
-            data->fieldType[fieldIndex] = 'N';
-            data->fieldCount = ++fieldIndex;
-            data->delimeter = false;
-        }
-    }
-    else // Insert NULL('\0') into character array if NON-alphanumeric character detected
-    {
-        data->buffer[count] = '\0';
-        data->delimeter = true;
-    }
-
-    // Increment the count of characters entered by user
-    data->characterCount++;
-
-}
-
-// Function to Return a Token as a String
-void getFieldString(USER_DATA* data, char fieldString[], uint8_t fieldNumber)
-{
-    uint8_t offset, index = 0;
-
-    // Get position of first character in string of interest
-    offset = data->fieldPosition[fieldNumber];
-
-    // Copy characters for return
-    while(data->buffer[offset] != '\0')
-    {
-        fieldString[index++] = data->buffer[offset++];
-    }
-
-    // Add NULL to terminate string
-    fieldString[index] = '\0';
-}
-
-// Function to Return a Token as an Integer
-int32_t getFieldInteger(USER_DATA* data, uint8_t fieldNumber)
-{
-    int32_t num;
-    uint8_t offset, index = 0;
-    char copy[MAX_CHARS + 1];
-
-    offset = data->fieldPosition[fieldNumber];  // Get position of first character in string of interest
-
-    while(data->buffer[offset] != '\0')
-    {
-        copy[index++] = data->buffer[offset++];
-    }
-
-    copy[index] = '\0';
-
-    num = atoi(copy);
-
-    return num;
-}
-
-// Function Used to Determine if Correct Command Entered
-bool isCommand(USER_DATA* data, const char strCommand[], uint8_t minArguments)
-{
-    bool command = false;
-    char copy[MAX_CHARS + 1];
-    uint8_t offset = 0, index = 0;
-
-    while(data->buffer[offset] != '\0')
-    {
-        copy[index++] = data->buffer[offset++];
-    }
-
-    copy[index] = '\0';
-
-    if((strcmp(strCommand, copy) == 0) && (data->fieldCount >= minArguments))
-    {
-        command = true;
-    }
-
-    return command;
-}
-
-// Function to reset User Input for next command
-void resetUserInput(USER_DATA* data)
-{
-    data->characterCount = 0;
-    data->fieldCount = 0;
-    data->delimeter = true;
-    data->endOfString = false;
-}
-
+// shell.c
+// William Bozarth
+// Created on: October 7, 2020
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "tm4c123gh6pm.h"
+#include "uart0.h"
+#include "shell.h"
+
+// Function to get Input from Terminal
+void getsUart0(USER_DATA* data)
+{
+    uint8_t count;
+    char c;
+
+    count = data->characterCount;
+
+    c = UART0_DR_R & 0xFF; // Get character
+
+    UART0_ICR_R = UART_ICR_RXIC | UART_ICR_RTIC; // Clear Rx interrupts, a pending Tx one is still needed
+
+    // Determine if user input is complete
+    if((c == 13) || (count == MAX_CHARS))
+    {
+        char buffer[10] = "\r\n";
+        data->buffer[count] = '\0';
+        data->endOfString = true;
+        sendUart0String(buffer);
+    }
+    else if ((c == 8 || c == 127) && count > 0) // Decrement count if invalid character entered
+    {
+        count--;
+        data->characterCount = count;
+    }
+    else if (c >= ' ' && c < 127) // Converts capital letter to lower case (if necessary)
+    {
+        if('A' <= c && c <= 'Z')
+        {
+            data->buffer[count] = c + 32;
+        }
+        else
+        {
+            data->buffer[count] = c;
+        }
+
+        data->characterCount = count + 1;
+    }
+}
+
+// Returns true if character belongs to a token rather than a delimiter
+static bool isFieldCharacter(char c)
+{
+    return ('a' <= c && c <= 'z') || ('0' <= c && c <= '9') || c == '-' || c == '+' || c == '.' || c == '_';
+}
+
+// Convert a single hex digit, returns -1 if not a hex digit
+static int8_t hexDigit(char c)
+{
+    if('0' <= c && c <= '9')
+    {
+        return c - '0';
+    }
+    else if('a' <= c && c <= 'f')
+    {
+        return c - 'a' + 10;
+    }
+
+    return -1;
+}
+
+// Classify a NULL terminated token and parse its value. Accepts [+|-]digits,
+// [+|-]0xhex and [+|-]digits.digits, anything else is an alpha field. A
+// number too large for an int32_t is an alpha field too, so numeric
+// arguments refuse it.
+static void parseFieldValue(const char str[], FIELD* field)
+{
+    uint8_t i = 0, digits = 0;
+    int32_t value = 0, scale = FIXED_POINT_SCALE;
+    bool negative = false, fraction = false;
+    int8_t digit;
+
+    field->type = 'A';
+    field->value = 0;
+
+    if(str[i] == '-' || str[i] == '+')
+    {
+        negative = (str[i] == '-');
+        i++;
+    }
+
+    if(str[i] == '0' && str[i + 1] == 'x')
+    {
+        for(i += 2; (digit = hexDigit(str[i])) >= 0; i++, digits++)
+        {
+            if(value > (INT32_MAX >> 4))
+            {
+                return;
+            }
+
+            value = (value << 4) | digit;
+        }
+    }
+    else
+    {
+        for(; str[i] != '\0'; i++)
+        {
+            if('0' <= str[i] && str[i] <= '9')
+            {
+                digit = str[i] - '0';
+
+                if(!fraction)
+                {
+                    if(value > (INT32_MAX - digit) / 10)
+                    {
+                        return;
+                    }
+
+                    value = (value * 10) + digit;
+                }
+                else if(scale > 1)
+                {
+                    scale /= 10;
+                    if(value > INT32_MAX - (digit * scale))
+                    {
+                        return;
+                    }
+
+                    value += digit * scale;
+                }
+                digits++;
+            }
+            else if(str[i] == '.' && !fraction)
+            {
+                if(value > INT32_MAX / FIXED_POINT_SCALE)
+                {
+                    return;
+                }
+
+                fraction = true;
+                value *= FIXED_POINT_SCALE;
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+
+    // Token must be entirely numeric to be typed as a number
+    if(digits == 0 || str[i] != '\0')
+    {
+        return;
+    }
+
+    field->type = fraction ? 'F' : 'N';
+    field->value = negative ? -value : value;
+}
+
+// Function to Tokenize Strings. Runs once over the next ';' separated command
+// of the completed line, replacing delimiters with NULL('\0') so every field
+// can be read in place. Everything after an '=' is kept as a single raw ('R')
+// field. Returns false once every command on the line has been tokenized.
+bool parseFields(USER_DATA* data)
+{
+    uint8_t i = data->nextCommand, start;
+    char c;
+    FIELD* field;
+
+    data->fieldCount = 0;
+
+    if(data->buffer[i] == '\0')
+    {
+        return false;
+    }
+
+    while((c = data->buffer[i]) != '\0' && c != ';' && c != '=')
+    {
+        // Insert NULL('\0') into character array if delimiter detected
+        if(!isFieldCharacter(c))
+        {
+            data->buffer[i++] = '\0';
+            continue;
+        }
+
+        start = i;
+        while(isFieldCharacter(data->buffer[i]))
+        {
+            i++;
+        }
+
+        c = data->buffer[i];
+        data->buffer[i] = '\0';
+
+        if(data->fieldCount < MAX_FIELDS)
+        {
+            field = &data->field[data->fieldCount++];
+            field->position = start;
+            field->length = i - start;
+            parseFieldValue(&data->buffer[start], field);
+        }
+
+        // Leave command separators in place for the check above
+        if(c == ';' || c == '=')
+        {
+            data->buffer[i] = c;
+        }
+        else if(c != '\0')
+        {
+            i++;
+        }
+    }
+
+    if(c == '=')
+    {
+        data->buffer[i++] = '\0';
+
+        while(data->buffer[i] == ' ')
+        {
+            i++;
+        }
+
+        if(data->fieldCount < MAX_FIELDS)
+        {
+            field = &data->field[data->fieldCount++];
+            field->position = i;
+            field->length = strlen(&data->buffer[i]);
+            field->type = 'R';
+            field->value = 0;
+        }
+
+        i += strlen(&data->buffer[i]);
+    }
+    else if(c == ';')
+    {
+        data->buffer[i++] = '\0';
+    }
+
+    data->nextCommand = i;
+
+    return true;
+}
+
+// Function to Return a Token as a String
+void getFieldString(USER_DATA* data, char fieldString[], uint8_t fieldNumber)
+{
+    strcpy(fieldString, getFieldView(data, fieldNumber));
+}
+
+// Function to Return a Token in place, without copying it
+const char* getFieldView(USER_DATA* data, uint8_t fieldNumber)
+{
+    if(fieldNumber >= data->fieldCount)
+    {
+        return "";
+    }
+
+    return &data->buffer[data->field[fieldNumber].position];
+}
+
+// Function to Return a Token as an Integer, fractions are truncated
+int32_t getFieldInteger(USER_DATA* data, uint8_t fieldNumber)
+{
+    if(fieldNumber >= data->fieldCount)
+    {
+        return 0;
+    }
+    else if(data->field[fieldNumber].type == 'F')
+    {
+        return data->field[fieldNumber].value / FIXED_POINT_SCALE;
+    }
+
+    return data->field[fieldNumber].value;
+}
+
+// Function to Return a Token in units of 1/FIXED_POINT_SCALE, integers too
+// large for that are saturated
+int32_t getFieldFixed(USER_DATA* data, uint8_t fieldNumber)
+{
+    int32_t value;
+
+    if(fieldNumber >= data->fieldCount)
+    {
+        return 0;
+    }
+
+    value = data->field[fieldNumber].value;
+
+    if(data->field[fieldNumber].type == 'N')
+    {
+        if(value > INT32_MAX / FIXED_POINT_SCALE)
+        {
+            return INT32_MAX;
+        }
+        else if(value < INT32_MIN / FIXED_POINT_SCALE)
+        {
+            return INT32_MIN;
+        }
+
+        return value * FIXED_POINT_SCALE;
+    }
+
+    return value;
+}
+
+// Function to Return a Token times scale, where the Token may be a fraction.
+// Negative Tokens return 0 and results too large for 32 bits are saturated.
+uint32_t getFieldScaled(USER_DATA* data, uint8_t fieldNumber, uint32_t scale)
+{
+    uint64_t scaled;
+    int32_t value;
+
+    if(fieldNumber >= data->fieldCount || data->field[fieldNumber].value < 0)
+    {
+        return 0;
+    }
+
+    value = data->field[fieldNumber].value;
+    scaled = (uint64_t)value * scale;
+
+    if(data->field[fieldNumber].type == 'F')
+    {
+        scaled /= FIXED_POINT_SCALE;
+    }
+
+    return (scaled > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32_t)scaled;
+}
+
+// Function Used to Determine if Correct Command Entered
+bool isCommand(USER_DATA* data, const char strCommand[], uint8_t minArguments)
+{
+    return (data->fieldCount >= minArguments) && (strcmp(strCommand, getFieldView(data, 0)) == 0);
+}
+
+// Function to reset User Input for next command
+void resetUserInput(USER_DATA* data)
+{
+    data->characterCount = 0;
+    data->fieldCount = 0;
+    data->nextCommand = 0;
+    data->endOfString = false;
+}
@@ -1,48 +1,64 @@
-// shell.h
-// William Bozarth
-// Created on: October 7, 2020
-
-//-----------------------------------------------------------------------------
-// Hardware Target
-//-----------------------------------------------------------------------------
-
-// Target Platform: EK-TM4C123GXL Evaluation Board
-// Target uC:       TM4C123GH6PM
-// System Clock:    40 MHz
-
-#ifndef SHELL_H_
-#define SHELL_H_
-
-#include "shell.h"
-
-//
-// Defines for Constants
-//
-#define MAX_CHARS 80
-#define MAX_FIELDS 5
-
-//
-// Structure Definition
-//
-typedef struct _USER_DATA
-{
-    bool    delimeter;
-    bool    endOfString;
-    uint8_t fieldCount;
-    uint8_t characterCount;
-    uint8_t fieldPosition[MAX_FIELDS];
-    char    fieldType[MAX_FIELDS];
-    char    buffer[MAX_CHARS + 1];
-} USER_DATA;
-
-//
-// Definitions
-//
-void getsUart0(USER_DATA* data);
-void parseFields(USER_DATA* data);
-void resetUserInput(USER_DATA* data);
-bool isCommand(USER_DATA* data, const char strCommand[], uint8_t minArguments);
-void getFieldString(USER_DATA* data, char fieldString[], uint8_t fieldNumber);
-int32_t getFieldInteger(USER_DATA* data, uint8_t fieldNumber);
-
-#endif /* SHELL_H_ */
+// shell.h
+// William Bozarth
+// Created on: October 7, 2020
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#ifndef SHELL_H_
+#define SHELL_H_
+
+#include "shell.h"
+
+//
+// Defines for Constants
+//
+#define MAX_CHARS 80
+#define MAX_FIELDS 5
+#define FIXED_POINT_SCALE 1000
+
+//
+// Structure Definition
+//
+
+// View of one token inside USER_DATA.buffer. Type is 'A' (alpha), 'N'
+// (signed decimal or hex integer), 'F' (decimal fraction) or 'R' (raw text
+// following an '='). Value holds the parsed number, in units of
+// 1/FIXED_POINT_SCALE for 'F' fields.
+typedef struct _FIELD
+{
+    uint8_t position;
+    uint8_t length;
+    char    type;
+    int32_t value;
+} FIELD;
+
+typedef struct _USER_DATA
+{
+    bool    endOfString;
+    uint8_t fieldCount;
+    uint8_t characterCount;
+    uint8_t nextCommand;
+    FIELD   field[MAX_FIELDS];
+    char    buffer[MAX_CHARS + 1];
+} USER_DATA;
+
+//
+// Definitions
+//
+void getsUart0(USER_DATA* data);
+bool parseFields(USER_DATA* data);
+void resetUserInput(USER_DATA* data);
+bool isCommand(USER_DATA* data, const char strCommand[], uint8_t minArguments);
+void getFieldString(USER_DATA* data, char fieldString[], uint8_t fieldNumber);
+const char* getFieldView(USER_DATA* data, uint8_t fieldNumber);
+int32_t getFieldInteger(USER_DATA* data, uint8_t fieldNumber);
+int32_t getFieldFixed(USER_DATA* data, uint8_t fieldNumber);
+uint32_t getFieldScaled(USER_DATA* data, uint8_t fieldNumber, uint32_t scale);
+
+#endif /* SHELL_H_ */
@@ -0,0 +1,106 @@
+// stable.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+// Temporal stabilization of match results. The last window labels are kept in
+// a ring with a vote count per label, so each sample costs O(1).
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "stable.h"
+
+STABILIZER stable = {0};
+
+// Clear the window and forget the stable state
+void resetStabilizer(STABILIZER* stabilizer)
+{
+    memset(stabilizer->votes, 0, sizeof(stabilizer->votes));
+    stabilizer->head = 0;
+    stabilizer->filled = 0;
+    stabilizer->run = 0;
+    stabilizer->runLabel = STABLE_UNSET;
+    stabilizer->state = STABLE_UNSET;
+}
+
+// Set window length, votes needed within it and consecutive samples needed,
+// each limited to a usable range
+void configureStabilizer(STABILIZER* stabilizer, uint8_t window, uint8_t majority, uint8_t dwell)
+{
+    if(window < 1)
+    {
+        window = 1;
+    }
+    else if(window > MAX_WINDOW)
+    {
+        window = MAX_WINDOW;
+    }
+
+    if(majority < 1)
+    {
+        majority = 1;
+    }
+    else if(majority > window)
+    {
+        majority = window;
+    }
+
+    stabilizer->window = window;
+    stabilizer->majority = majority;
+    stabilizer->dwell = (dwell < 1) ? 1 : dwell;
+
+    resetStabilizer(stabilizer);
+}
+
+// Add the best match label of a sample, STABLE_NONE if nothing matched.
+// Returns true when the stable state changes.
+bool updateStabilizer(STABILIZER* stabilizer, uint16_t label)
+{
+    if(label > STABLE_NONE)
+    {
+        label = STABLE_NONE;
+    }
+
+    // Drop the oldest label once the window is full
+    if(stabilizer->filled == stabilizer->window)
+    {
+        stabilizer->votes[stabilizer->history[stabilizer->head]]--;
+    }
+    else
+    {
+        stabilizer->filled++;
+    }
+
+    stabilizer->history[stabilizer->head] = label;
+    stabilizer->votes[label]++;
+    stabilizer->head = (stabilizer->head + 1 == stabilizer->window) ? 0 : stabilizer->head + 1;
+
+    if(label == stabilizer->runLabel)
+    {
+        if(stabilizer->run < 0xFF)
+        {
+            stabilizer->run++;
+        }
+    }
+    else
+    {
+        stabilizer->runLabel = label;
+        stabilizer->run = 1;
+    }
+
+    if(label != stabilizer->state && stabilizer->votes[label] >= stabilizer->majority && stabilizer->run >= stabilizer->dwell)
+    {
+        stabilizer->state = label;
+        return true;
+    }
+
+    return false;
+}
@@ -0,0 +1,57 @@
+// stable.h
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#ifndef STABLE_H_
+#define STABLE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "eeprom.h"
+
+//
+// Defines
+//
+#define MAX_WINDOW    16
+#define STABLE_NONE   TOTAL_COLORS      // label of a sample that matched no reference
+#define STABLE_UNSET  0xFFFF            // no state established yet
+
+// Debounces the best match of successive samples. A label becomes the stable
+// state once it holds at least majority of the last window samples and has
+// been the best match of dwell samples in a row.
+typedef struct _STABILIZER
+{
+    bool     mode;
+    uint8_t  window;
+    uint8_t  majority;
+    uint8_t  dwell;
+    uint8_t  head;
+    uint8_t  filled;
+    uint8_t  run;
+    uint16_t runLabel;
+    uint16_t state;
+    uint16_t history[MAX_WINDOW];
+    uint8_t  votes[TOTAL_COLORS + 1];
+} STABILIZER;
+
+//
+// Global Variables
+//
+extern STABILIZER stable;
+
+//
+// Definitions
+//
+void configureStabilizer(STABILIZER* stabilizer, uint8_t window, uint8_t majority, uint8_t dwell);
+void resetStabilizer(STABILIZER* stabilizer);
+bool updateStabilizer(STABILIZER* stabilizer, uint16_t label);
+
+#endif /* STABLE_H_ */
@@ -0,0 +1,179 @@
+// stats.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+// Runtime health counters (see stats.h). Subsystems count events with
+// COUNT_STAT(), the stats command and the report task print a snapshot of
+// all of them as text or as one binary frame.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "tm4c123gh6pm.h"
+#include "uart0.h"
+#include "format.h"
+#include "tasks.h"
+#include "stats.h"
+
+// Subsystem and name of each counter, in STAT_ order, kept in flash
+typedef struct _STAT_INFO
+{
+    const char* subsystem;
+    const char* name;
+} STAT_INFO;
+
+static const STAT_INFO statInfo[MAX_STATS] =
+{
+    {"uart0",  "tx full"},
+    {"uart0",  "rx overruns"},
+    {"timers", "deadlines dropped"},
+    {"adc0",   "reads"},
+    {"adc0",   "busy waits"},
+    {"eeprom", "words written"},
+    {"led",    "samples"},
+    {"led",    "samples emitted"},
+};
+
+volatile uint32_t statCounters[MAX_STATS] = {0};
+uint8_t statsFormat = STATS_TEXT;
+
+// Posts the report task while automatic reports are on
+static TASK_TIMER statsTimer = {0};
+
+void countStat(uint8_t stat)
+{
+    uint32_t state = _disable_interrupts();
+
+    statCounters[stat]++;
+
+    _restore_interrupts(state);
+}
+
+void resetStats(void)
+{
+    uint32_t state = _disable_interrupts();
+    uint8_t i;
+
+    for(i = 0; i < MAX_STATS; i++)
+    {
+        statCounters[i] = 0;
+    }
+
+    _restore_interrupts(state);
+}
+
+// Copy every counter at one instant, so a report is consistent
+void copyStats(uint32_t counters[])
+{
+    uint32_t state = _disable_interrupts();
+    uint8_t i;
+
+    for(i = 0; i < MAX_STATS; i++)
+    {
+        counters[i] = statCounters[i];
+    }
+
+    _restore_interrupts(state);
+}
+
+// Fill frame with the binary report of counters, returns its length
+uint8_t packStats(const uint32_t counters[], uint8_t frame[])
+{
+    uint8_t i, length = 0, sum = 0;
+
+    frame[length++] = STATS_SYNC;
+    frame[length++] = MAX_STATS;
+
+    for(i = 0; i < MAX_STATS; i++)
+    {
+        frame[length++] = counters[i] & 0xFF;
+        frame[length++] = (counters[i] >> 8) & 0xFF;
+        frame[length++] = (counters[i] >> 16) & 0xFF;
+        frame[length++] = counters[i] >> 24;
+    }
+
+    for(i = 0; i < length; i++)
+    {
+        sum += frame[i];
+    }
+
+    frame[length++] = sum;
+
+    return length;
+}
+
+// Print counters as text, one line per subsystem
+void printStats(const uint32_t counters[])
+{
+    uint8_t i;
+
+    for(i = 0; i < MAX_STATS; i++)
+    {
+        if(i == 0 || strcmp(statInfo[i].subsystem, statInfo[i - 1].subsystem) != 0)
+        {
+            sendUart0String((i == 0) ? "  " : "\r\n  ");
+            sendUart0StringLiteral(statInfo[i].subsystem);
+            sendUart0String(": ");
+        }
+        else
+        {
+            sendUart0String(", ");
+        }
+
+        sendUart0StringLiteral(statInfo[i].name);
+        sendUart0String(" ");
+        sendUart0Unsigned(counters[i]);
+    }
+
+    sendUart0String("\r\n");
+}
+
+// Print a snapshot of the counters in format
+void reportStats(uint8_t format)
+{
+    uint32_t counters[MAX_STATS];
+    uint8_t frame[STATS_FRAME_SIZE], length, i;
+
+    copyStats(counters);
+
+    if(format == STATS_BINARY)
+    {
+        length = packStats(counters, frame);
+
+        for(i = 0; i < length; i++)
+        {
+            putcUart0(frame[i]);
+        }
+    }
+    else
+    {
+        printStats(counters);
+    }
+}
+
+// Report in statsFormat every seconds s, 1 to MAX_STATS_PERIOD
+void startStatsReport(uint16_t seconds)
+{
+    uint32_t ticks = (seconds * (uint32_t)1000000) / TASK_TICK;
+
+    startTaskTimer(&scheduler, &statsTimer, TASK_STATS, ticks, ticks);
+}
+
+void stopStatsReport(void)
+{
+    stopTaskTimer(&scheduler, &statsTimer);
+}
+
+// Report task, posted by statsTimer
+void statsTask(void)
+{
+    reportStats(statsFormat);
+}
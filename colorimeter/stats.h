@@ -0,0 +1,68 @@
+// stats.h
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#ifndef STATS_H_
+#define STATS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//
+// Defines
+//
+
+// Health counters, described in the same order by statInfo in stats.c
+#define STAT_TX_FULL       0                     // characters that waited for room in the Tx ring
+#define STAT_RX_OVERRUN    1                     // Rx FIFO overruns, characters lost
+#define STAT_DEADLINES     2                     // Timer1 deadlines dropped during a sample
+#define STAT_ADC_READS     3
+#define STAT_ADC_WAITS     4                     // polls of a busy ADC0 SS3
+#define STAT_EEPROM_WRITES 5                     // words
+#define STAT_SAMPLES       6                     // samples measured and reported
+#define STAT_EMITTED       7                     // samples that printed a record
+#define MAX_STATS          8
+
+#define STATS_TEXT         0
+#define STATS_BINARY       1
+
+// Binary report: STATS_SYNC, MAX_STATS, each counter in 4 bytes least
+// significant first, then the 8-bit sum of every byte before it
+#define STATS_SYNC         0xA5
+#define STATS_FRAME_SIZE   (3 + (4 * MAX_STATS))
+
+#define MAX_STATS_PERIOD   3600                  // s between automatic reports
+
+// O(1) count of one event, from any priority level. The same event can be
+// counted by the shell, by PendSV and by ISRs, so the increment runs in a
+// short critical section.
+#define COUNT_STAT(stat)   countStat(stat)
+
+//
+// Global Variables
+//
+extern volatile uint32_t statCounters[MAX_STATS];
+extern uint8_t statsFormat;
+
+//
+// Definitions
+//
+void countStat(uint8_t stat);
+void resetStats(void);
+void copyStats(uint32_t counters[]);
+uint8_t packStats(const uint32_t counters[], uint8_t frame[]);
+void printStats(const uint32_t counters[]);
+void reportStats(uint8_t format);
+void startStatsReport(uint16_t seconds);
+void stopStatsReport(void);
+void statsTask(void);
+
+#endif /* STATS_H_ */
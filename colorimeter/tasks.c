@@ -0,0 +1,242 @@
+// tasks.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+// Run-to-completion task scheduler for the main loop (see tasks.h). ISRs and
+// the timer wheel post events to tasks, the main loop runs the most urgent
+// ready task and sleeps in WFI when none is ready. Samples are not tasks:
+// they keep their deadlines as deferred work in PendSV, which preempts every
+// task.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "tm4c123gh6pm.h"
+#include "uart0.h"
+#include "format.h"
+#include "cycles.h"
+#include "timestamp.h"
+#include "tasks.h"
+
+SCHEDULER scheduler = {0};
+
+// Give task id its handler and the name printTasks() shows
+void registerTask(SCHEDULER* s, uint8_t id, const char* name, TASK_HANDLER handler)
+{
+    s->task[id].name = name;
+    s->task[id].handler = handler;
+}
+
+// Mark a task ready from any context
+void postTask(SCHEDULER* s, uint8_t id)
+{
+    uint32_t state = _disable_interrupts();
+
+    s->ready |= (uint32_t)1 << id;
+    s->task[id].posts++;
+
+    _restore_interrupts(state);
+}
+
+// Link a timer into the wheel slot of its due tick, interrupts must be off
+static void insertTimer(SCHEDULER* s, TASK_TIMER* timer)
+{
+    TASK_TIMER** slot = &s->wheel[timer->due & (WHEEL_SLOTS - 1)];
+
+    timer->next = *slot;
+    *slot = timer;
+}
+
+// Unlink a timer from its wheel slot, interrupts must be off
+static void removeTimer(SCHEDULER* s, TASK_TIMER* timer)
+{
+    TASK_TIMER** link = &s->wheel[timer->due & (WHEEL_SLOTS - 1)];
+
+    while(*link != 0)
+    {
+        if(*link == timer)
+        {
+            *link = timer->next;
+            break;
+        }
+
+        link = &(*link)->next;
+    }
+}
+
+// Post task id delay ticks from now (at least 1), then every period ticks
+// unless period is 0. A timer already running is restarted.
+void startTaskTimer(SCHEDULER* s, TASK_TIMER* timer, uint8_t id, uint32_t delay, uint32_t period)
+{
+    uint32_t state = _disable_interrupts();
+
+    if(timer->active)
+    {
+        removeTimer(s, timer);
+    }
+
+    timer->due = s->now + ((delay > 0) ? delay : 1);
+    timer->period = period;
+    timer->task = id;
+    timer->active = true;
+    insertTimer(s, timer);
+
+    _restore_interrupts(state);
+}
+
+void stopTaskTimer(SCHEDULER* s, TASK_TIMER* timer)
+{
+    uint32_t state = _disable_interrupts();
+
+    if(timer->active)
+    {
+        removeTimer(s, timer);
+        timer->active = false;
+    }
+
+    _restore_interrupts(state);
+}
+
+// Advance one tick, run from the SysTick ISR. Only the slot of the new tick
+// is visited; timers in it that are due a whole turn or more later are put
+// back. The busy percentage is updated at the end of each load window.
+void tickScheduler(SCHEDULER* s)
+{
+    TASK_TIMER *timer, *next;
+    uint32_t slot, window, idle;
+    uint64_t time;
+
+    s->now++;
+    slot = s->now & (WHEEL_SLOTS - 1);
+    timer = s->wheel[slot];
+    s->wheel[slot] = 0;
+
+    while(timer != 0)
+    {
+        next = timer->next;
+
+        if(timer->due == s->now)
+        {
+            postTask(s, timer->task);
+
+            if(timer->period == 0)
+            {
+                timer->active = false;
+                timer = next;
+                continue;
+            }
+
+            timer->due += timer->period;
+        }
+
+        insertTimer(s, timer);
+        timer = next;
+    }
+
+    if(++s->windowTicks >= LOAD_WINDOW)
+    {
+        time = readTimestamp();
+        window = time - s->windowStart;
+        idle = (s->idleTime < window) ? s->idleTime : window;
+
+        s->busy = (window > 0) ? ((uint64_t)(window - idle) * 10000) / window : 0;
+        if(s->busy > s->peakBusy)
+        {
+            s->peakBusy = s->busy;
+        }
+
+        s->windowStart = time;
+        s->windowTicks = 0;
+        s->idleTime = 0;
+    }
+}
+
+// Run the most urgent ready task, or sleep until the next interrupt if none
+// is ready. Returns true if a task ran.
+bool runTasks(SCHEDULER* s)
+{
+    TASK* task;
+    uint32_t state, start, elapsed;
+    uint64_t sleep;
+    uint8_t id;
+
+    // Checking for work and sleeping are one critical section, so an event
+    // posted in between still ends the sleep. WFI wakes on a pending
+    // interrupt with interrupts off, and the ISR runs once they are restored.
+    // The core clock, and with it the cycle counter, stops in WFI, so the
+    // sleep is timed by the us timestamp.
+    state = _disable_interrupts();
+
+    if(s->ready == 0)
+    {
+        sleep = readTimestamp();
+        __asm(" WFI");
+        s->idleTime += readTimestamp() - sleep;
+
+        _restore_interrupts(state);
+
+        return false;
+    }
+
+    for(id = 0; !(s->ready & ((uint32_t)1 << id)); id++);
+    s->ready &= ~((uint32_t)1 << id);
+
+    _restore_interrupts(state);
+
+    task = &s->task[id];
+    start = readCycleCounter();
+
+    if(task->handler != 0)
+    {
+        task->handler();
+    }
+
+    elapsed = readCycleCounter() - start;
+
+    task->runs++;
+    if(elapsed > task->longest)
+    {
+        task->longest = elapsed;
+    }
+
+    return true;
+}
+
+// Print the busy percentage and the counters of each task
+void printTasks(const SCHEDULER* s)
+{
+    uint8_t id;
+
+    sendUart0String("  busy ");
+    sendUart0Fixed(s->busy, 2);
+    sendUart0String("%, peak ");
+    sendUart0Fixed(s->peakBusy, 2);
+    sendUart0String("%, ");
+    sendUart0Unsigned(s->now);
+    sendUart0String(" ticks\r\n");
+
+    for(id = 0; id < MAX_TASKS; id++)
+    {
+        if(s->task[id].name == 0)
+        {
+            continue;
+        }
+
+        sendUart0String("  ");
+        sendUart0StringLiteral(s->task[id].name);
+        sendUart0String(": ");
+        sendUart0Unsigned(s->task[id].posts);
+        sendUart0String(" posts, ");
+        sendUart0Unsigned(s->task[id].runs);
+        sendUart0String(" runs, longest ");
+        sendUart0Unsigned(cyclesToMicroseconds(s->task[id].longest));
+        sendUart0String(" us\r\n");
+    }
+}
@@ -0,0 +1,87 @@
+// tasks.h
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#ifndef TASKS_H_
+#define TASKS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//
+// Defines
+//
+
+// Tasks in priority order, the lowest number runs first
+#define TASK_BLINK         0                     // ends the status LED blink of a sample
+#define TASK_SHELL         1                     // reads and runs commands
+#define TASK_PERSIST       2                     // writes changed colors and settings to EEPROM
+#define TASK_STATS         3                     // automatic health counter reports
+#define MAX_TASKS          4
+
+#define TASK_TICK          1000                  // us per SysTick, one timer wheel slot
+#define WHEEL_SLOTS        16                    // power of 2
+#define LOAD_WINDOW        1000                  // ticks the busy percentage is measured over
+
+typedef void (*TASK_HANDLER)(void);
+
+// A task runs to completion once for any number of events posted to it
+// before it starts
+typedef struct _TASK
+{
+    const char*  name;
+    TASK_HANDLER handler;
+    uint32_t     posts;
+    uint32_t     runs;
+    uint32_t     longest;                       // cycles, longest run
+} TASK;
+
+// Posts its task when due, then every period ticks unless the period is 0.
+// Timers hash into the wheel slot of their due tick.
+typedef struct _TASK_TIMER
+{
+    struct _TASK_TIMER* next;
+    uint32_t due;                               // tick
+    uint32_t period;                            // ticks
+    uint8_t  task;
+    bool     active;
+} TASK_TIMER;
+
+typedef struct _SCHEDULER
+{
+    TASK          task[MAX_TASKS];
+    TASK_TIMER*   wheel[WHEEL_SLOTS];
+    volatile uint32_t ready;                    // bit n is set while task n has an event
+    volatile uint32_t now;                      // ticks since start
+    uint64_t      windowStart;                  // us timestamp, start of the load window
+    uint32_t      windowTicks;
+    uint32_t      idleTime;                     // us spent waiting in the current window
+    uint16_t      busy;                         // hundredths of a percent, last window
+    uint16_t      peakBusy;
+} SCHEDULER;
+
+//
+// Global Variables
+//
+extern SCHEDULER scheduler;
+
+//
+// Definitions
+//
+void registerTask(SCHEDULER* s, uint8_t id, const char* name, TASK_HANDLER handler);
+void postTask(SCHEDULER* s, uint8_t id);
+void startTaskTimer(SCHEDULER* s, TASK_TIMER* timer, uint8_t id, uint32_t delay, uint32_t period);
+void stopTaskTimer(SCHEDULER* s, TASK_TIMER* timer);
+void tickScheduler(SCHEDULER* s);
+bool runTasks(SCHEDULER* s);
+void printTasks(const SCHEDULER* s);
+
+#endif /* TASKS_H_ */
@@ -0,0 +1,268 @@
+// cacheTest.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// Match cache hits and misses. A sample hits only while every channel is
+// within epsilon of the cached query, and any bump of colorVersion or change
+// of the match settings misses until the search stores a new result. A
+// replayed stream of noisy samples and library changes must hit exactly when
+// a cache that remembers every store would, and the hit rate is reported.
+// eepromTest checks that each change to the library bumps colorVersion.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test.h"
+#include "eeprom.h"
+#include "lab.h"
+#include "led.h"
+#include "timestamp.h"
+#include "rank.h"
+#include "cache.h"
+
+#define REPLAY_SAMPLES 200000
+
+static char output[256];
+static uint16_t outputLength = 0;
+
+//
+// Fakes
+//
+
+uint32_t colorVersion = 0;
+uint8_t matchMetric = MATCH_RGB;
+uint8_t matchValue = 20;
+
+void sendUart0String(char str[])
+{
+    outputLength += snprintf(&output[outputLength], sizeof(output) - outputLength, "%s", str);
+}
+
+void sendUart0Stamp(uint64_t time, char separator) {}
+
+//
+// Helpers
+//
+
+static void clearOutput(void)
+{
+    outputLength = 0;
+    output[0] = 0;
+}
+
+// A ranking of one made up match, distinct for each seed
+static void makeRanking(RANKING* ranking, uint16_t seed)
+{
+    resetRanking(ranking, 2);
+    offerRanking(ranking, seed % TOTAL_COLORS, seed * 3, NO_CONFIDENCE);
+}
+
+static bool sameRanking(const RANKING* first, const RANKING* second)
+{
+    return first->count == second->count && first->entry[0].index == second->entry[0].index
+           && first->entry[0].distanceSquared == second->entry[0].distanceSquared;
+}
+
+static uint8_t clampChannel(int16_t value)
+{
+    return (value < 0) ? 0 : (value > 255) ? 255 : value;
+}
+
+//
+// Tests
+//
+
+// Each channel on its own and all together, at epsilon and one past it
+static void testEpsilon(void)
+{
+    MATCH_CACHE cache;
+    RANKING stored, found;
+    int8_t offset;
+    uint8_t channel, query[3];
+    bool ok = true;
+
+    configureMatchCache(&cache, true, 3);
+    makeRanking(&stored, 7);
+    storeMatchCache(&cache, 100, 150, 200, 2, &stored);
+
+    for(channel = 0; channel < 4; channel++)
+    {
+        for(offset = -4; offset <= 4; offset++)
+        {
+            query[0] = 100 + ((channel == 0 || channel == 3) ? offset : 0);
+            query[1] = 150 + ((channel == 1 || channel == 3) ? offset : 0);
+            query[2] = 200 + ((channel == 2 || channel == 3) ? offset : 0);
+            memset(&found, 0, sizeof(found));
+
+            if(lookupMatchCache(&cache, query[0], query[1], query[2], 2, &found))
+            {
+                ok = ok && abs(offset) <= 3 && sameRanking(&found, &stored);
+            }
+            else
+            {
+                ok = ok && abs(offset) > 3;
+            }
+        }
+    }
+
+    CHECK(ok);
+    CHECK(cache.hits == 4 * 7 && cache.misses == 4 * 2);
+
+    // Epsilon 0 hits the same sample only, and channels do not wrap
+    configureMatchCache(&cache, true, 0);
+    storeMatchCache(&cache, 0, 255, 1, 2, &stored);
+    CHECK(lookupMatchCache(&cache, 0, 255, 1, 2, &found));
+    CHECK(!lookupMatchCache(&cache, 255, 255, 1, 2, &found));
+    CHECK(!lookupMatchCache(&cache, 0, 0, 1, 2, &found));
+    CHECK(!lookupMatchCache(&cache, 0, 255, 2, 2, &found));
+}
+
+// Every bump of the library version misses, as does any change of the
+// settings the search used
+static void testInvalidation(void)
+{
+    MATCH_CACHE cache;
+    RANKING stored, found;
+    uint16_t i;
+    bool ok = true;
+
+    configureMatchCache(&cache, true, 5);
+    makeRanking(&stored, 9);
+
+    for(i = 0; i < 1000; i++)
+    {
+        storeMatchCache(&cache, 10, 20, 30, 2, &stored);
+        ok = ok && lookupMatchCache(&cache, 10, 20, 30, 2, &found);
+
+        colorVersion += 1 + (i % 3);
+        ok = ok && !lookupMatchCache(&cache, 10, 20, 30, 2, &found);
+        ok = ok && !lookupMatchCache(&cache, 10, 20, 30, 2, &found);
+    }
+
+    CHECK(ok);
+    CHECK(cache.hits == 1000 && cache.misses == 2000);
+
+    // The version wrapping around still misses
+    colorVersion = 0xFFFFFFFF;
+    storeMatchCache(&cache, 10, 20, 30, 2, &stored);
+    colorVersion++;
+    CHECK(!lookupMatchCache(&cache, 10, 20, 30, 2, &found));
+
+    storeMatchCache(&cache, 10, 20, 30, 2, &stored);
+    matchMetric = MATCH_LAB;
+    CHECK(!lookupMatchCache(&cache, 10, 20, 30, 2, &found));
+    matchMetric = MATCH_RGB;
+
+    matchValue++;
+    CHECK(!lookupMatchCache(&cache, 10, 20, 30, 2, &found));
+    matchValue--;
+
+    CHECK(!lookupMatchCache(&cache, 10, 20, 30, 4, &found));
+    CHECK(lookupMatchCache(&cache, 10, 20, 30, 2, &found));
+
+    // Turning the cache on again forgets the result
+    configureMatchCache(&cache, true, 5);
+    CHECK(!lookupMatchCache(&cache, 10, 20, 30, 2, &found));
+}
+
+// A cache that is off never answers or counts
+static void testOff(void)
+{
+    MATCH_CACHE cache;
+    RANKING stored, found;
+
+    configureMatchCache(&cache, false, 5);
+    makeRanking(&stored, 1);
+    storeMatchCache(&cache, 10, 20, 30, 2, &stored);
+
+    CHECK(!lookupMatchCache(&cache, 10, 20, 30, 2, &found));
+    CHECK(!cache.valid && cache.hits == 0 && cache.misses == 0);
+
+    clearOutput();
+    printMatchCache(&cache);
+    CHECK(strcmp(output, "  cache off, epsilon 5, hits 0, misses 0\r\n") == 0);
+}
+
+// Noisy samples of a target that moves now and then, with library changes
+// between them. The search runs and stores on every miss, as getMeasurement()
+// does.
+static void testReplay(void)
+{
+    MATCH_CACHE cache;
+    RANKING stored, found;
+    int16_t target[3] = {120, 60, 200};
+    uint8_t sample[3], query[3] = {0}, channel, epsilon = 2;
+    uint32_t n, version = 0, expectedHits = 0;
+    bool valid = false, hit, expected, ok = true;
+
+    configureMatchCache(&cache, true, epsilon);
+
+    for(n = 0; n < REPLAY_SAMPLES && ok; n++)
+    {
+        if(rand() % 200 == 0)
+        {
+            target[rand() % 3] = rand() % 256;
+        }
+
+        if(rand() % 500 == 0)
+        {
+            colorVersion++;
+        }
+
+        for(channel = 0; channel < 3; channel++)
+        {
+            sample[channel] = clampChannel(target[channel] + (rand() % 5) - 2);
+        }
+
+        expected = valid && version == colorVersion;
+        for(channel = 0; channel < 3; channel++)
+        {
+            expected = expected && abs(sample[channel] - query[channel]) <= epsilon;
+        }
+
+        hit = lookupMatchCache(&cache, sample[0], sample[1], sample[2], 2, &found);
+        ok = hit == expected && (!hit || sameRanking(&found, &stored));
+        expectedHits += expected;
+
+        if(!hit)
+        {
+            makeRanking(&stored, n);
+            storeMatchCache(&cache, sample[0], sample[1], sample[2], 2, &stored);
+            memcpy(query, sample, sizeof(query));
+            version = colorVersion;
+            valid = true;
+        }
+    }
+
+    CHECK(ok);
+    CHECK(cache.hits == expectedHits && cache.hits + cache.misses == REPLAY_SAMPLES);
+
+    clearOutput();
+    printMatchCache(&cache);
+    CHECK(strstr(output, "  cache on, epsilon 2, hits ") == output && strstr(output, "%\r\n") != 0);
+
+    REPORT("%u noisy samples: %u hits, %.1f%% hit rate\n", REPLAY_SAMPLES, cache.hits,
+           100.0 * cache.hits / REPLAY_SAMPLES);
+}
+
+int main(void)
+{
+    srand(37);
+
+    testEpsilon();
+    testInvalidation();
+    testOff();
+    testReplay();
+
+    return testResult("cache");
+}
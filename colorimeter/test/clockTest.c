@@ -0,0 +1,123 @@
+// clockTest.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// System clock setup, built by the Makefile once for each supported
+// SYSTEM_CLOCK_MHZ. The registers initSystemClock() and setUart0BaudRate()
+// write are decoded back into the clock, LED PWM and baud rate they give.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "test.h"
+#include "tm4c123gh6pm.h"
+#include "clock.h"
+#include "cycles.h"
+#include "gpio.h"
+#include "reboot.h"
+#include "stats.h"
+#include "tasks.h"
+#include "uart0.h"
+
+#define LED_PWM_LOAD     1024                   // PWM counts per LED period, as pwm0.c sets
+#define BAUD_RATE        115200
+
+static uint32_t dataRegister;
+
+//
+// Fakes
+//
+
+SCHEDULER scheduler;
+volatile uint32_t* hostUart0Data(void) { return &dataRegister; }
+void enablePort(PORT port) {}
+void selectPinPushPullOutput(PORT port, uint8_t pin) {}
+void selectPinDigitalInput(PORT port, uint8_t pin) {}
+void setPinAuxFunction(PORT port, uint8_t pin, uint32_t fn) {}
+void postTask(SCHEDULER* s, uint8_t id) {}
+void recordProbe(uint8_t probe, uint32_t cycles) {}
+void countStat(uint8_t stat) {}
+uint32_t readCycleCounter(void) { return 0; }
+
+//
+// Tests
+//
+
+static void testSystemClock(void)
+{
+    uint32_t divisor, pwm;
+
+    SYSCTL_RIS_R = SYSCTL_RIS_PLLLRIS;
+    initSystemClock();
+
+    // RCC2 runs from the PLL, divided straight from 400 MHz
+    CHECK((SYSCTL_RCC2_R & SYSCTL_RCC2_USERCC2) && (SYSCTL_RCC2_R & SYSCTL_RCC2_DIV400));
+    CHECK(!(SYSCTL_RCC2_R & SYSCTL_RCC2_BYPASS2));
+
+    divisor = (((SYSCTL_RCC2_R & SYSCTL_RCC2_SYSDIV2_M) >> SYSCTL_RCC2_SYSDIV2_S) << 1)
+            + ((SYSCTL_RCC2_R & SYSCTL_RCC2_SYSDIV2LSB) ? 1 : 0) + 1;
+    CHECK(PLL_MHZ == divisor * SYSTEM_CLOCK_MHZ);
+
+    // The LED PWM stays near 19.5 kHz, the period it was tuned for
+    pwm = (SYSCTL_RCC_R & SYSCTL_RCC_USEPWMDIV) ? 2 << ((SYSCTL_RCC_R & SYSCTL_RCC_PWMDIV_M) >> SYSCTL_RCC_PWMDIV_S) : 1;
+    CHECK(pwm == pwmDivisor(SYSTEM_CLOCK_MHZ));
+    CHECK(SYSTEM_CLOCK / pwm / LED_PWM_LOAD >= 15600 && SYSTEM_CLOCK / pwm / LED_PWM_LOAD <= 24500);
+}
+
+// Baud error within 0.1%, from the divisor the UART uses
+static void testBaudRate(void)
+{
+    uint64_t divisorTimes64, baud;
+
+    setUart0BaudRate(BAUD_RATE, SYSTEM_CLOCK);
+
+    divisorTimes64 = (UART0_IBRD_R * 64) + UART0_FBRD_R;
+    baud = ((uint64_t)SYSTEM_CLOCK * 4) / divisorTimes64;
+
+    CHECK(baud * 1000 >= BAUD_RATE * 999ull && baud * 1000 <= BAUD_RATE * 1001ull);
+}
+
+// Counts that scale with the clock fit their registers
+static void testScaledCounts(void)
+{
+    CHECK((TASK_TICK * CYCLES_PER_MICROSECOND) - 1 < (1 << 24));
+    CHECK((uint64_t)TIMEOUT_MS * (SYSTEM_CLOCK / 1000) <= UINT32_MAX);
+}
+
+static void testPllDivisor(void)
+{
+    uint32_t mhz, supported = 0;
+
+    for(mhz = 1; mhz <= 100; mhz++)
+    {
+        if(pllDivisor(mhz) != 0)
+        {
+            CHECK(mhz == 80 || mhz == 50 || mhz == 40 || mhz == 25 || mhz == 20 || mhz == 16);
+            supported++;
+        }
+    }
+
+    CHECK(supported == 6);
+}
+
+int main(void)
+{
+    char name[16];
+
+    testSystemClock();
+    testBaudRate();
+    testScaledCounts();
+    testPllDivisor();
+
+    sprintf(name, "clock %u MHz", SYSTEM_CLOCK_MHZ);
+
+    return testResult(name);
+}
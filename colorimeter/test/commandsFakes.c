@@ -0,0 +1,157 @@
+// commandsFakes.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gpio.h"
+#include "uart0.h"
+#include "shell.h"
+#include "reboot.h"
+#include "wait.h"
+#include "pwm0.h"
+#include "timers.h"
+#include "led.h"
+#include "eeprom.h"
+#include "lab.h"
+#include "model.h"
+#include "rank.h"
+#include "stable.h"
+#include "cache.h"
+#include "cycles.h"
+#include "journal.h"
+#include "logger.h"
+#include "schedule.h"
+#include "interrupts.h"
+#include "tasks.h"
+#include "timestamp.h"
+#include "profile.h"
+#include "stats.h"
+#include "commandsFakes.h"
+
+uint16_t fakeRgb[3];
+uint32_t fakeRgbSets = 0;
+
+static uint32_t dataRegister;
+
+//
+// Settings the commands change
+//
+
+STORED_COLORS color;
+COMMIT_STATS commitStats;
+DELTA_MODE delta;
+MATCH_CACHE matchCache;
+STABILIZER stable;
+SCHEDULE schedule;
+SCHEDULER scheduler;
+bool autoCommit = true;
+bool calibrateMode = false;
+bool validCalibration = false;
+int threshold = 0;
+bool logMode = false;
+bool periodicMode = false;
+uint32_t periodicValue = 100000;
+bool printTest = false;
+bool testMode = false;
+bool sampleLed = false;
+bool stampMode = false;
+bool rebootFlag = false;
+bool matchMode = false;
+uint8_t matchValue = 0;
+uint8_t matchMetric = 0;
+uint8_t rankSize = 0;
+uint8_t rankFormat = 0;
+uint8_t rampFormat = 0;
+uint8_t statsFormat = 0;
+uint32_t settleTime = SETTLE_TIME;
+uint16_t ledRed = 0;
+uint16_t ledGreen = 0;
+uint16_t ledBlue = 0;
+
+//
+// Hardware
+//
+
+volatile uint32_t* hostUart0Data(void) { return &dataRegister; }
+bool getPinValue(PORT port, uint8_t pin) { return false; }
+void setPinValue(PORT port, uint8_t pin, bool value) {}
+void waitMicrosecond(uint32_t us) {}
+uint32_t cyclesToMicroseconds(uint32_t cycles) { return cycles; }
+uint64_t readTimestamp(void) { return 0; }
+
+void setRgbColor(uint16_t red, uint16_t green, uint16_t blue)
+{
+    fakeRgb[0] = red;
+    fakeRgb[1] = green;
+    fakeRgb[2] = blue;
+    fakeRgbSets++;
+}
+
+//
+// Sampling
+//
+
+bool pauseSampling(void) { return false; }
+void resumeSampling(bool running) {}
+bool holdSampling(void) { return false; }
+void releaseSampling(bool wasHeld) {}
+bool startPeriodic(uint32_t period) { return true; }
+void periodicT(uint32_t period) {}
+uint32_t measurementTime(void) { return 0; }
+void getMeasurement(void) {}
+void measureRgb(void) {}
+void calibrateLed(int threshold) {}
+void testLED(void) {}
+void printRampTable(void) {}
+void configureStabilizer(STABILIZER* stabilizer, uint8_t window, uint8_t majority, uint8_t dwell) {}
+void configureMatchCache(MATCH_CACHE* cache, bool mode, uint8_t epsilon) {}
+void printMatchCache(const MATCH_CACHE* cache) {}
+
+//
+// Color library
+//
+
+bool isColorValid(uint16_t index) { return false; }
+void setColor(uint16_t index, uint32_t red, uint32_t green, uint32_t blue) {}
+void setColorModel(uint16_t index, uint16_t model) {}
+void eraseColor(int index) {}
+void storeColors(void) {}
+uint16_t commitColors(void) { return 0; }
+void commitSettings(void) {}
+void requestCommit(uint8_t what) {}
+void printLearnedColors(void) {}
+void printJournal(void) {}
+void addColorSample(COLOR_STATS* stats, uint8_t red, uint8_t green, uint8_t blue) {}
+void getColorMean(const COLOR_STATS* stats, uint8_t mean[3]) {}
+uint16_t getColorModel(const COLOR_STATS* stats) { return 0; }
+void resetColorStats(COLOR_STATS* stats) {}
+
+//
+// Reports
+//
+
+void sendUart0Unsigned(uint32_t value) {}
+void sendUart0Triplet(uint32_t first, uint32_t second, uint32_t third) {}
+void sendUart0Timestamp(uint64_t time) {}
+void clearLog(void) {}
+void dumpLog(void) {}
+void flushLog(void) {}
+void printLog(void) {}
+void printInterrupts(void) {}
+void printProfile(void) {}
+void resetProfile(void) {}
+void printSchedule(const SCHEDULE* schedule) {}
+void printTasks(const SCHEDULER* s) {}
+void reportStats(uint8_t format) {}
+void resetStats(void) {}
+void startStatsReport(uint16_t seconds) {}
+void stopStatsReport(void) {}
@@ -0,0 +1,29 @@
+// commandsFakes.h
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// Stand-ins for the modules commands.c drives, shared by the tests that link
+// commands.c. They do nothing but record the LED color set, which is how a
+// test sees that a command ran. The test still defines the UART output and
+// the EEPROM words macros.c reads and writes.
+
+#ifndef COMMANDS_FAKES_H_
+#define COMMANDS_FAKES_H_
+
+#include <stdint.h>
+
+//
+// Global Variables
+//
+extern uint16_t fakeRgb[3];                     // last color setRgbColor() was given
+extern uint32_t fakeRgbSets;                    // setRgbColor() calls
+
+#endif /* COMMANDS_FAKES_H_ */
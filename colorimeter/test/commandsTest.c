@@ -0,0 +1,293 @@
+// commandsTest.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// Command table and argument schemas. The table stays sorted so the binary
+// search finds every entry, each schema fits its minimum field count, field
+// count and type errors print the usage, and a corpus of command lines gets
+// the same lookups as a linear scan, timed both ways.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "test.h"
+#include "shell.h"
+#include "commands.h"
+#include "commandsFakes.h"
+
+#define CORPUS_SIZE  320
+#define TIMING_ROUNDS 2000
+
+static char output[1024];
+static uint16_t outputLength = 0;
+
+// Command lines, parsed once
+static USER_DATA corpus[CORPUS_SIZE];
+static uint16_t corpusSize = 0;
+
+//
+// Fakes
+//
+
+uint32_t readEeprom(uint16_t add) { return 0xFFFFFFFF; }
+void writeEeprom(uint16_t add, uint32_t data) {}
+
+void readEepromWords(uint16_t add, uint32_t data[], uint16_t count)
+{
+    while(count--)
+    {
+        *data++ = 0xFFFFFFFF;
+    }
+}
+
+void sendUart0String(char str[])
+{
+    outputLength += snprintf(&output[outputLength], sizeof(output) - outputLength, "%s", str);
+}
+
+void sendUart0StringLiteral(const char str[])
+{
+    sendUart0String((char*)str);
+}
+
+//
+// Helpers
+//
+
+static void clearOutput(void)
+{
+    outputLength = 0;
+    output[0] = 0;
+}
+
+// Parse the first command of line into data
+static void parseLine(USER_DATA* data, const char line[])
+{
+    resetUserInput(data);
+    strcpy(data->buffer, line);
+    parseFields(data);
+}
+
+// Returns true if line passes the schema of its command
+static bool accepts(const char line[])
+{
+    USER_DATA data;
+    const COMMAND* command;
+
+    parseLine(&data, line);
+    command = findCommand(getFieldView(&data, 0));
+
+    return command != 0 && validArguments(&data, command);
+}
+
+// The lookup findCommand() replaced
+static const COMMAND* linearFind(const char name[])
+{
+    uint8_t i;
+
+    for(i = 0; i < commandCount; i++)
+    {
+        if(strcmp(name, commandTable[i].name) == 0)
+        {
+            return &commandTable[i];
+        }
+    }
+
+    return 0;
+}
+
+static void addLine(const char line[])
+{
+    if(corpusSize < CORPUS_SIZE)
+    {
+        parseLine(&corpus[corpusSize++], line);
+    }
+}
+
+// Each command with arguments of every type, and names that just miss one
+static void buildCorpus(void)
+{
+    static const char* arguments[] = {"", " 1", " 0x10 2 3", " off", " 0.5 hz", " x y", " -7 99999999999", " = set 1 2 3"};
+    char line[MAX_CHARS + 1];
+    uint8_t i, j;
+
+    for(i = 0; i < commandCount; i++)
+    {
+        for(j = 0; j < sizeof(arguments) / sizeof(arguments[0]); j++)
+        {
+            sprintf(line, "%s%s", commandTable[i].name, arguments[j]);
+            addLine(line);
+        }
+
+        sprintf(line, "%ss 1", commandTable[i].name);
+        addLine(line);
+        sprintf(line, "%.3s", commandTable[i].name);
+        addLine(line);
+    }
+
+    addLine("a");
+    addLine("zzz");
+    addLine("go");
+}
+
+//
+// Tests
+//
+
+// Sorted names let the binary search reach every entry
+static void testTable(void)
+{
+    uint8_t i, j;
+    bool sorted = true, found = true, schemas = true;
+
+    for(i = 0; i < commandCount; i++)
+    {
+        sorted = sorted && (i == 0 || strcmp(commandTable[i - 1].name, commandTable[i].name) < 0);
+        found = found && findCommand(commandTable[i].name) == &commandTable[i];
+
+        // The required fields are the command and a prefix of its arguments,
+        // each argument a known type, and the usage starts with the name
+        schemas = schemas && commandTable[i].minFields >= 1
+                  && commandTable[i].minFields <= strlen(commandTable[i].arguments) + 1
+                  && strlen(commandTable[i].arguments) < MAX_FIELDS
+                  && strncmp(commandTable[i].usage, commandTable[i].name, strlen(commandTable[i].name)) == 0
+                  && commandTable[i].handler != 0;
+
+        for(j = 0; commandTable[i].arguments[j] != '\0'; j++)
+        {
+            schemas = schemas && strchr("NFAOPR", commandTable[i].arguments[j]) != 0;
+        }
+    }
+
+    CHECK(sorted);
+    CHECK(found);
+    CHECK(schemas);
+
+    CHECK(findCommand("") == 0 && findCommand("a") == 0 && findCommand("zzz") == 0);
+    CHECK(findCommand("colo") == 0 && findCommand("colors") == 0);
+}
+
+static void testSchemas(void)
+{
+    // Minimum field counts
+    CHECK(!accepts("set 1 2"));
+    CHECK(accepts("set 1 2 3"));
+    CHECK(!accepts("print"));
+    CHECK(accepts("periodic"));
+
+    // Numeric fields, extra fields are left to the handler
+    CHECK(accepts("color 3 0x2"));
+    CHECK(accepts("set 1 2 3 4"));
+    CHECK(!accepts("set 1 2 x"));
+    CHECK(!accepts("color 3 0.5"));
+
+    // Numeric or "off", numbers too large for 32 bits are alpha
+    CHECK(accepts("delta off") && accepts("delta 5"));
+    CHECK(!accepts("delta 0.5"));
+    CHECK(!accepts("match 99999999999"));
+
+    // Fractions or "off"
+    CHECK(accepts("periodic 0.5 hz") && accepts("periodic off"));
+    CHECK(!accepts("periodic on"));
+    CHECK(!accepts("periodic 10 5"));
+
+    // Raw text after '='
+    CHECK(accepts("macro go = set 1 2 3") && accepts("macro go"));
+    CHECK(!accepts("macro 5 = set 1 2 3"));
+}
+
+// Errors print the usage or report an unknown command, and run no handler
+static void testErrors(void)
+{
+    USER_DATA data;
+
+    fakeRgbSets = 0;
+
+    clearOutput();
+    parseLine(&data, "set 1 2");
+    dispatchCommand(&data);
+    CHECK(strcmp(output, "  Usage: set R G B\r\n") == 0);
+
+    clearOutput();
+    parseLine(&data, "stable x");
+    dispatchCommand(&data);
+    CHECK(strcmp(output, "  Usage: stable N [M] [D]|OFF\r\n") == 0);
+
+    clearOutput();
+    parseLine(&data, "sett 100");
+    dispatchCommand(&data);
+    CHECK(strcmp(output, "  Invalid command.\r\n") == 0);
+
+    CHECK(fakeRgbSets == 0);
+
+    parseLine(&data, "set 1 2 3");
+    dispatchCommand(&data);
+    CHECK(fakeRgbSets == 1 && fakeRgb[0] == 1 && fakeRgb[1] == 2 && fakeRgb[2] == 3);
+}
+
+// The binary search agrees with a linear scan over the corpus
+static void testCorpus(void)
+{
+    const COMMAND* command;
+    uint32_t round, accepted = 0;
+    uint16_t i;
+    bool same = true;
+    clock_t start;
+    double binary, linear;
+
+    buildCorpus();
+
+    for(i = 0; i < corpusSize; i++)
+    {
+        same = same && findCommand(getFieldView(&corpus[i], 0)) == linearFind(getFieldView(&corpus[i], 0));
+    }
+
+    CHECK(same);
+
+    start = clock();
+    for(round = 0; round < TIMING_ROUNDS; round++)
+    {
+        for(i = 0; i < corpusSize; i++)
+        {
+            command = findCommand(getFieldView(&corpus[i], 0));
+            accepted += command != 0 && validArguments(&corpus[i], command);
+        }
+    }
+    binary = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    for(round = 0; round < TIMING_ROUNDS; round++)
+    {
+        for(i = 0; i < corpusSize; i++)
+        {
+            command = linearFind(getFieldView(&corpus[i], 0));
+            accepted -= command != 0 && validArguments(&corpus[i], command);
+        }
+    }
+    linear = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    CHECK(accepted == 0);
+
+    REPORT("%u lines: findCommand %.1f ns, linear scan %.1f ns per line with validArguments\n", corpusSize,
+           1e9 * binary / ((double)TIMING_ROUNDS * corpusSize), 1e9 * linear / ((double)TIMING_ROUNDS * corpusSize));
+}
+
+int main(void)
+{
+    testTable();
+    testSchemas();
+    testErrors();
+    testCorpus();
+
+    return testResult("commands");
+}
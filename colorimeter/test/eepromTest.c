@@ -0,0 +1,546 @@
+// eepromTest.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// Color library over a simulated EEPROM and migration flash page. Libraries
+// in the 16 word per color layout and in the packed layout move into the
+// journal, also when the power is cut at any write, and the settings come
+// back from their two word records. A commit writes only the records of
+// changed colors, each word once, and skips those already stored, and its
+// latency follows the words written. Every change to the library bumps its
+// version, which the match cache checks.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <setjmp.h>
+#include "test.h"
+#include "tm4c123gh6pm.h"
+#include "eeprom.h"
+#include "journal.h"
+#include "flash.h"
+#include "lab.h"
+#include "model.h"
+#include "led.h"
+#include "rank.h"
+#include "stable.h"
+#include "stats.h"
+#include "tasks.h"
+
+#define EEPROM_WORDS (32 * EEPROM_BLOCK_WORDS)
+#define PAGE_WORDS   256
+#define WRITE_CYCLES 4000                       // simulated cost of an EEPROM word write
+
+static uint32_t eeprom[EEPROM_WORDS];
+static uint32_t page[PAGE_WORDS];
+static uint32_t now = 0;                        // simulated cycle counter
+static uint32_t eepromWrites = 0;
+static int32_t writesLeft = -1;                 // writes before the power cut, -1 never
+static jmp_buf powerCut;
+static char output[1024];
+static uint16_t outputLength = 0;
+
+// Expected library after a load
+static uint32_t expectedRgb[TOTAL_COLORS];
+static uint16_t expectedModel[TOTAL_COLORS];
+static bool expectedValid[TOTAL_COLORS];
+
+//
+// Fakes
+//
+
+SCHEDULER scheduler;
+STABILIZER stable;
+uint8_t __MIGRATION_PAGE[4 * PAGE_WORDS];
+uint16_t rgbLeds[3];
+uint8_t matchValue = 0;
+bool matchMode = false;
+uint8_t matchMetric = 0;
+uint8_t rankSize = 0;
+uint8_t rankFormat = 0;
+
+volatile uint32_t* hostEepromWord(uint8_t increment)
+{
+    volatile uint32_t* word = &eeprom[(EEPROM_EEBLOCK_R * EEPROM_BLOCK_WORDS) + EEPROM_EEOFFSET_R];
+
+    if(increment)
+    {
+        EEPROM_EEOFFSET_R = (EEPROM_EEOFFSET_R + 1) % EEPROM_BLOCK_WORDS;
+    }
+
+    return word;
+}
+
+// Called once each EEPROM word is written, where the power may go. Each
+// write advances the cycle counter.
+void countStat(uint8_t stat)
+{
+    if(stat != STAT_EEPROM_WRITES)
+    {
+        return;
+    }
+
+    eepromWrites++;
+    now += WRITE_CYCLES;
+
+    if(writesLeft == 0)
+    {
+        longjmp(powerCut, 1);
+    }
+
+    if(writesLeft > 0)
+    {
+        writesLeft--;
+    }
+}
+
+bool eraseFlashPage(uint32_t address)
+{
+    memset(page, 0xFF, sizeof(page));
+
+    return true;
+}
+
+// Programming flash can only clear bits
+bool writeFlashWord(uint32_t address, uint32_t data)
+{
+    if(writesLeft == 0)
+    {
+        longjmp(powerCut, 1);
+    }
+
+    if(writesLeft > 0)
+    {
+        writesLeft--;
+    }
+
+    page[(address - MIGRATION_PAGE) / 4] &= data;
+
+    return true;
+}
+
+uint32_t readFlashWord(uint32_t address)
+{
+    return page[(address - MIGRATION_PAGE) / 4];
+}
+
+void configureStabilizer(STABILIZER* stabilizer, uint8_t window, uint8_t majority, uint8_t dwell)
+{
+    stabilizer->window = window;
+    stabilizer->majority = majority;
+    stabilizer->dwell = dwell;
+}
+
+void sendUart0String(char str[])
+{
+    outputLength += snprintf(&output[outputLength], sizeof(output) - outputLength, "%s", str);
+}
+
+void sendUart0Unsigned(uint32_t value)
+{
+    outputLength += snprintf(&output[outputLength], sizeof(output) - outputLength, "%u", value);
+}
+
+void sendUart0Triplet(uint32_t first, uint32_t second, uint32_t third)
+{
+    outputLength += snprintf(&output[outputLength], sizeof(output) - outputLength, "%u, %u, %u", first, second, third);
+}
+
+void sendUart0Fixed(int32_t value, uint8_t decimals) {}
+void buildColorGrid(void) {}
+void insertColorGrid(uint16_t index) {}
+void removeColorGrid(uint16_t index) {}
+void updateColorLab(uint16_t index) {}
+void postTask(SCHEDULER* s, uint8_t id) {}
+uint32_t readCycleCounter(void) { return now; }
+uint32_t cyclesToMicroseconds(uint32_t cycles) { return cycles; }
+
+//
+// Helpers
+//
+
+static void clearOutput(void)
+{
+    outputLength = 0;
+    output[0] = 0;
+}
+
+static void clearExpected(void)
+{
+    memset(expectedRgb, 0, sizeof(expectedRgb));
+    memset(expectedModel, 0, sizeof(expectedModel));
+    memset(expectedValid, 0, sizeof(expectedValid));
+}
+
+static void expectColor(uint16_t index, uint32_t rgb, uint16_t model)
+{
+    expectedRgb[index] = rgb;
+    expectedModel[index] = model;
+    expectedValid[index] = true;
+}
+
+// Compare the library in RAM with the expected one
+static bool libraryMatches(void)
+{
+    uint16_t i;
+    bool ok = true;
+
+    for(i = 0; i < TOTAL_COLORS; i++)
+    {
+        ok = ok && isColorValid(i) == expectedValid[i];
+
+        if(expectedValid[i])
+        {
+            ok = ok && color.rgb[i] == expectedRgb[i] && color.model[i] == expectedModel[i];
+        }
+    }
+
+    return ok;
+}
+
+static bool migrationStaged(void)
+{
+    return (page[0] & 0xFFFF0000) == MIGRATION_MAGIC;
+}
+
+// Colors in the original layout, one per 16 word block with a valid flag of
+// 1 and a word each for red, green and blue
+static void writeLegacyLibrary(void)
+{
+    uint16_t i;
+
+    memset(eeprom, 0xFF, sizeof(eeprom));
+    clearExpected();
+
+    for(i = 0; i < LEGACY_COLORS; i++)
+    {
+        if(i % 5 == 2)
+        {
+            continue;
+        }
+
+        eeprom[EEPROM_BLOCK_WORDS * i] = 1;
+        eeprom[(EEPROM_BLOCK_WORDS * i) + 1] = i * 10;
+        eeprom[(EEPROM_BLOCK_WORDS * i) + 2] = 255 - i;
+        eeprom[(EEPROM_BLOCK_WORDS * i) + 3] = i;
+        expectColor(i, COLOR_RGB(i * 10, 255 - i, i), 0);
+    }
+}
+
+// A color of the packed layout, its model two per word
+static void writePackedColor(uint16_t packed, uint32_t rgb, uint16_t model)
+{
+    uint32_t* models = &eeprom[COLOR_MODEL_ADDRESS + (packed >> 1)];
+
+    eeprom[COLOR_BITMAP_ADDRESS + (packed >> 5)] |= (uint32_t)1 << (packed & 31);
+    eeprom[COLOR_RGB_ADDRESS + packed] = rgb;
+    *models = (*models & ~((uint32_t)0xFFFF << (16 * (packed & 1)))) | ((uint32_t)model << (16 * (packed & 1)));
+}
+
+static void startPackedLibrary(void)
+{
+    memset(eeprom, 0xFF, sizeof(eeprom));
+    memset(&eeprom[COLOR_BITMAP_ADDRESS], 0, 4 * PACKED_BITMAP_WORDS);
+    memset(&eeprom[COLOR_MODEL_ADDRESS], 0, 4 * (PACKED_COLORS / 2));
+    eeprom[COLOR_HEADER_ADDRESS] = COLOR_HEADER;
+    clearExpected();
+}
+
+// Returns the number of EEPROM words that differ from a copy
+static uint16_t wordsChanged(const uint32_t before[])
+{
+    uint16_t i, changed = 0;
+
+    for(i = 0; i < EEPROM_WORDS; i++)
+    {
+        changed += eeprom[i] != before[i];
+    }
+
+    return changed;
+}
+
+// Returns true if writes is what appending records costs, two words each
+// and a header for every block opened
+static bool recordWords(uint32_t writes, uint16_t records)
+{
+    return writes >= records * JOURNAL_RECORD_WORDS
+           && writes <= (records * JOURNAL_RECORD_WORDS) + (records / JOURNAL_SLOTS) + 1;
+}
+
+// Commit the dirty colors, returns the EEPROM words written. Every word
+// written must have changed.
+static uint32_t commitWords(uint16_t* committed, bool* ok)
+{
+    static uint32_t before[EEPROM_WORDS];
+    uint32_t writes = eepromWrites;
+
+    memcpy(before, eeprom, sizeof(eeprom));
+    *committed = commitColors();
+    writes = eepromWrites - writes;
+    *ok = *ok && wordsChanged(before) == writes && commitStats.lastCycles == writes * WRITE_CYCLES;
+
+    return writes;
+}
+
+//
+// Tests
+//
+
+// The original layout moves into the journal, which the next boot mounts
+static void testLegacyMigration(void)
+{
+    writeLegacyLibrary();
+    eraseFlashPage(MIGRATION_PAGE);
+
+    loadColors();
+    CHECK(libraryMatches() && countColors() == 13);
+    CHECK(!migrationStaged());
+
+    // The journal now holds the library, the old blocks are gone
+    CHECK(eeprom[EEPROM_BLOCK_WORDS * 3] != 1);
+
+    loadColors();
+    CHECK(libraryMatches());
+    CHECK(countJournal() == 13 + 1);
+}
+
+// Cut the power at every write of the migration. The next boot must end with
+// the whole library in the journal and the flash copy dropped.
+static void testLegacyMigrationPowerCut(void)
+{
+    int32_t cut;
+    bool ok = true, finished = false;
+
+    for(cut = 0; !finished; cut++)
+    {
+        writeLegacyLibrary();
+        eraseFlashPage(MIGRATION_PAGE);
+        writesLeft = cut;
+
+        if(!setjmp(powerCut))
+        {
+            loadColors();
+            finished = true;
+        }
+
+        writesLeft = -1;
+
+        loadColors();
+        ok = ok && libraryMatches() && !migrationStaged();
+
+        loadColors();
+        ok = ok && libraryMatches();
+    }
+
+    CHECK(ok);
+    CHECK(cut > 2 * LEGACY_COLORS);
+}
+
+// Packed colors keep their index below TOTAL_COLORS, the others move to the
+// lowest free indexes
+static void testPackedMigration(void)
+{
+    startPackedLibrary();
+    writePackedColor(0, 0x010203, 0);
+    writePackedColor(3, 0x102030, 0x8421);
+    writePackedColor(100, 0xFF0000, 0);
+    writePackedColor(200, 0x00FF00, 0x8001);
+    writePackedColor(255, 0x0000FF, 0x9999);
+    eraseFlashPage(MIGRATION_PAGE);
+
+    expectColor(0, 0x010203, 0);
+    expectColor(3, 0x102030, 0x8421);
+    expectColor(100, 0xFF0000, 0);
+    expectColor(1, 0x00FF00, 0x8001);
+    expectColor(2, 0x0000FF, 0x9999);
+
+    clearOutput();
+    loadColors();
+    CHECK(libraryMatches());
+    CHECK(strcmp(output, "  color 200 is now color 1.\r\n  color 255 is now color 2.\r\n") == 0);
+
+    loadColors();
+    CHECK(libraryMatches());
+}
+
+// With every index below TOTAL_COLORS taken a packed color past them is shown
+static void testPackedMigrationFull(void)
+{
+    uint16_t i;
+
+    startPackedLibrary();
+
+    for(i = 0; i < TOTAL_COLORS; i++)
+    {
+        writePackedColor(i, i, 0);
+        expectColor(i, i, 0);
+    }
+
+    writePackedColor(130, COLOR_RGB(1, 2, 3), 0);
+    eraseFlashPage(MIGRATION_PAGE);
+
+    clearOutput();
+    loadColors();
+    CHECK(libraryMatches());
+    CHECK(strcmp(output, "  color 130 NOT kept, no free index: 1, 2, 3\r\n") == 0);
+
+    loadColors();
+    CHECK(libraryMatches() && countJournal() == TOTAL_COLORS + 1);
+}
+
+// Calibration and settings come back from their two word records
+static void testSettings(void)
+{
+    threshold = 4095;
+    validCalibration = true;
+    rgbLeds[0] = 1023;
+    rgbLeds[1] = 512;
+    rgbLeds[2] = 1;
+    matchValue = 200;
+    matchMetric = MATCH_LAB;
+    matchMode = true;
+    rankSize = MAX_RANK - 1;
+    rankFormat = RANK_CSV;
+    stable.mode = true;
+    configureStabilizer(&stable, MAX_WINDOW, 9, 250);
+
+    commitSettings();
+
+    threshold = 0;
+    validCalibration = false;
+    rgbLeds[0] = rgbLeds[1] = rgbLeds[2] = 0;
+    matchValue = matchMetric = rankSize = rankFormat = 0;
+    matchMode = stable.mode = false;
+    configureStabilizer(&stable, 0, 0, 0);
+
+    loadColors();
+    CHECK(validCalibration && threshold == 4095);
+    CHECK(rgbLeds[0] == 1023 && rgbLeds[1] == 512 && rgbLeds[2] == 1);
+    CHECK(matchValue == 200 && matchMetric == MATCH_LAB && matchMode);
+    CHECK(rankSize == MAX_RANK - 1 && rankFormat == RANK_CSV);
+    CHECK(stable.mode && stable.window == MAX_WINDOW && stable.majority == 9 && stable.dwell == 250);
+}
+
+// Only the records of changed colors are written, in one batch
+static void testDirty(void)
+{
+    uint16_t committed, i;
+    uint32_t writes, single, skipped;
+    bool ok = true;
+
+    // An empty journal, so no block is compacted
+    memset(eeprom, 0xFF, sizeof(eeprom));
+    eraseFlashPage(MIGRATION_PAGE);
+    loadColors();
+    memset(&commitStats, 0, sizeof(commitStats));
+
+    // Colors in several bitmap words, one of them learned twice
+    setColor(0, 10, 20, 30);
+    setColor(31, 11, 21, 31);
+    setColor(32, 12, 22, 32);
+    setColor(TOTAL_COLORS - 1, 13, 23, 33);
+    setColor(31, 14, 24, 34);
+    CHECK(isColorDirty(0) && isColorDirty(31) && isColorDirty(32) && isColorDirty(TOTAL_COLORS - 1));
+    CHECK(!isColorDirty(1) && !isColorDirty(33));
+
+    writes = commitWords(&committed, &ok);
+    CHECK(committed == 4 && recordWords(writes, 4));
+    CHECK(!isColorDirty(0) && !isColorDirty(31) && !isColorDirty(32) && !isColorDirty(TOTAL_COLORS - 1));
+
+    // Nothing dirty writes nothing
+    writes = commitWords(&committed, &ok);
+    CHECK(committed == 0 && writes == 0);
+
+    // Learning the stored values again writes nothing
+    skipped = journalStats.skipped;
+    setColor(32, 12, 22, 32);
+    setColor(0, 10, 20, 30);
+    writes = commitWords(&committed, &ok);
+    CHECK(committed == 2 && writes == 0 && journalStats.skipped == skipped + 2);
+
+    // One changed color writes one record
+    setColorModel(32, MODEL_VALID | 0x421);
+    single = commitWords(&committed, &ok);
+    CHECK(committed == 1 && recordWords(single, 1));
+
+    // An erase writes its tombstone once, a second erase is skipped
+    autoCommit = false;
+    eraseColor(31);
+    writes = commitWords(&committed, &ok);
+    CHECK(committed == 1 && recordWords(writes, 1));
+    eraseColor(31);
+    writes = commitWords(&committed, &ok);
+    CHECK(committed == 1 && writes == 0);
+    autoCommit = true;
+
+    CHECK(ok);
+
+    // What was committed comes back
+    loadColors();
+    CHECK(isColorValid(0) && color.rgb[0] == COLOR_RGB(10, 20, 30));
+    CHECK(isColorValid(32) && color.model[32] == (MODEL_VALID | 0x421));
+    CHECK(!isColorValid(31) && color.rgb[TOTAL_COLORS - 1] == COLOR_RGB(13, 23, 33));
+
+    // A batch of 32 colors costs 32 records
+    for(i = 64; i < 96; i++)
+    {
+        setColor(i, i, i, i);
+    }
+    writes = commitWords(&committed, &ok);
+    CHECK(ok && committed == 32 && recordWords(writes, 32));
+    CHECK(commitStats.commits == 7 && commitStats.maxCycles == writes * WRITE_CYCLES);
+
+    REPORT("commit of one color %u words, %u cycles; of 32 colors %u words, %u cycles\n",
+           single, single * WRITE_CYCLES, writes, commitStats.lastCycles);
+}
+
+// Learning, modeling, erasing and loading each bump the library version,
+// writing the journal changes nothing the matcher sees
+static void testVersion(void)
+{
+    uint32_t version = colorVersion;
+
+    setColor(5, 1, 2, 3);
+    CHECK(colorVersion == version + 1);
+
+    setColor(5, 4, 5, 6);
+    CHECK(colorVersion == version + 2);
+
+    setColorModel(5, MODEL_VALID);
+    CHECK(colorVersion == version + 3);
+
+    commitColors();
+    CHECK(colorVersion == version + 3);
+
+    eraseColor(5);
+    CHECK(colorVersion == version + 4);
+
+    // Erasing an index that is already free bumps it too
+    eraseColor(5);
+    CHECK(colorVersion == version + 5);
+
+    loadColors();
+    CHECK(colorVersion == version + 6);
+}
+
+int main(void)
+{
+    testLegacyMigration();
+    testLegacyMigrationPowerCut();
+    testPackedMigration();
+    testPackedMigrationFull();
+    testSettings();
+    testDirty();
+    testVersion();
+
+    return testResult("eeprom");
+}
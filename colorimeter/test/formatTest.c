@@ -0,0 +1,230 @@
+// formatTest.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// Number formatting against snprintf(). Decimal, hex, fixed point and CSV
+// triplet strings must match it for the limits of 8, 16 and 32-bit values,
+// the powers of ten around them and random values, and the lengths returned
+// must match the strings. The cost of both is reported.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "test.h"
+#include "format.h"
+
+#define RANDOM_VALUES 20000
+#define TIMING_ROUNDS 200000
+
+static char output[256];
+static uint16_t outputLength = 0;
+
+// Values around the limits of each width and every power of ten
+static uint32_t boundary[64];
+static uint8_t boundaries = 0;
+
+//
+// Fakes
+//
+
+void sendUart0String(char str[])
+{
+    outputLength += snprintf(&output[outputLength], sizeof(output) - outputLength, "%s", str);
+}
+
+//
+// Helpers
+//
+
+static void clearOutput(void)
+{
+    outputLength = 0;
+    output[0] = 0;
+}
+
+static void addBoundary(uint32_t value)
+{
+    boundary[boundaries++] = value;
+}
+
+static void buildBoundaries(void)
+{
+    uint32_t power;
+
+    addBoundary(0);
+    addBoundary(1);
+    addBoundary(INT8_MAX);
+    addBoundary(UINT8_MAX);
+    addBoundary(UINT8_MAX + 1);
+    addBoundary(INT16_MAX);
+    addBoundary(UINT16_MAX);
+    addBoundary(UINT16_MAX + 1);
+    addBoundary(INT32_MAX);
+    addBoundary((uint32_t)INT32_MAX + 1);
+    addBoundary(UINT32_MAX - 1);
+    addBoundary(UINT32_MAX);
+
+    for(power = 10; power <= 1000000000; power *= 10)
+    {
+        addBoundary(power - 1);
+        addBoundary(power);
+        addBoundary(power + 1);
+    }
+}
+
+static uint32_t random32(void)
+{
+    // Random widths too, so short numbers are as common as long ones
+    return (((uint32_t)rand() << 16) ^ rand()) >> (rand() % 32);
+}
+
+// Returns true if every format of value matches snprintf()
+static bool formatsMatch(uint32_t value)
+{
+    char str[FORMAT_TRIPLET_LENGTH], expected[FORMAT_TRIPLET_LENGTH];
+    uint64_t magnitude, scale;
+    int32_t signedValue = (int32_t)value;
+    uint8_t digits, decimals, length;
+    bool ok;
+
+    length = formatUnsigned(str, value);
+    snprintf(expected, sizeof(expected), "%u", value);
+    ok = strcmp(str, expected) == 0 && length == strlen(expected);
+
+    length = formatSigned(str, signedValue);
+    snprintf(expected, sizeof(expected), "%d", signedValue);
+    ok = ok && strcmp(str, expected) == 0 && length == strlen(expected);
+
+    for(digits = 0; digits <= 8; digits++)
+    {
+        length = formatHex(str, value, digits);
+        snprintf(expected, sizeof(expected), "%0*x", digits, value);
+        ok = ok && strcmp(str, expected) == 0 && length == strlen(expected);
+    }
+
+    magnitude = (signedValue < 0) ? -(int64_t)signedValue : signedValue;
+    for(decimals = 0, scale = 1; decimals <= 9; decimals++, scale *= 10)
+    {
+        length = formatFixed(str, signedValue, decimals);
+
+        if(decimals == 0)
+        {
+            snprintf(expected, sizeof(expected), "%d", signedValue);
+        }
+        else
+        {
+            snprintf(expected, sizeof(expected), "%s%llu.%0*llu", (signedValue < 0) ? "-" : "",
+                     (unsigned long long)(magnitude / scale), decimals, (unsigned long long)(magnitude % scale));
+        }
+
+        ok = ok && strcmp(str, expected) == 0 && length == strlen(expected);
+    }
+
+    length = formatTriplet(str, value, (uint8_t)value, (uint16_t)~value);
+    snprintf(expected, sizeof(expected), "%u,%u,%u", value, (uint8_t)value, (uint16_t)~value);
+    ok = ok && strcmp(str, expected) == 0 && length == strlen(expected);
+
+    if(!ok)
+    {
+        printf("  value %u\n", value);
+    }
+
+    return ok;
+}
+
+//
+// Tests
+//
+
+static void testBoundaries(void)
+{
+    uint8_t i;
+    bool ok = true;
+
+    buildBoundaries();
+
+    for(i = 0; i < boundaries; i++)
+    {
+        ok = formatsMatch(boundary[i]) && ok;
+        ok = formatsMatch(-boundary[i]) && ok;
+    }
+
+    CHECK(ok);
+    CHECK(boundaries == 12 + (3 * 9));
+}
+
+static void testRandom(void)
+{
+    uint32_t i;
+    bool ok = true;
+
+    for(i = 0; i < RANDOM_VALUES && ok; i++)
+    {
+        ok = formatsMatch(random32());
+    }
+
+    CHECK(ok);
+}
+
+// The longest strings fit the buffers the send functions use
+static void testSend(void)
+{
+    clearOutput();
+    sendUart0Unsigned(UINT32_MAX);
+    sendUart0Signed(INT32_MIN);
+    sendUart0Hex(0xABC, 8);
+    sendUart0Fixed(INT32_MIN, 9);
+    sendUart0Triplet(UINT32_MAX, 0, UINT32_MAX);
+    CHECK(strcmp(output, "4294967295-2147483648" "00000abc" "-2.147483648" "4294967295,0,4294967295") == 0);
+}
+
+// Report the cost of a decimal number both ways
+static void testTiming(void)
+{
+    char str[FORMAT_NUMBER_LENGTH];
+    uint32_t i, sum = 0;
+    clock_t start;
+    double format, library;
+
+    start = clock();
+    for(i = 0; i < TIMING_ROUNDS; i++)
+    {
+        sum += formatUnsigned(str, boundary[i % boundaries]);
+    }
+    format = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    for(i = 0; i < TIMING_ROUNDS; i++)
+    {
+        sum -= snprintf(str, sizeof(str), "%u", boundary[i % boundaries]);
+    }
+    library = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    CHECK(sum == 0);
+
+    REPORT("formatUnsigned %.1f ns, snprintf %.1f ns per number\n",
+           1e9 * format / TIMING_ROUNDS, 1e9 * library / TIMING_ROUNDS);
+}
+
+int main(void)
+{
+    srand(29);
+
+    testBoundaries();
+    testRandom();
+    testSend();
+    testTiming();
+
+    return testResult("format");
+}
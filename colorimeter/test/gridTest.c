@@ -0,0 +1,277 @@
+// gridTest.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// Color index, built by the Makefile once for each library size in
+// TOTAL_COLORS. After random learns, recolors and erases, the nearest color
+// and the colors within E must match a linear scan of the library, as must a
+// grid rebuilt from scratch. Queries over a full library are timed both ways.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "test.h"
+#include "eeprom.h"
+#include "grid.h"
+
+#define EDITS         20000
+#define QUERY_EVERY   10                        // edits between queries
+#define TIMING_QUERIES 20000
+
+// Colors visited by the last findColorsWithin()
+static bool visited[TOTAL_COLORS];
+static uint32_t visitedDistance[TOTAL_COLORS];
+static uint16_t visits = 0;
+static bool visitedTwice = false;
+
+//
+// Fakes
+//
+
+STORED_COLORS color;
+
+bool isColorValid(uint16_t index)
+{
+    return (color.validBits[index >> 5] >> (index & 31)) & 1;
+}
+
+//
+// Helpers
+//
+
+static void setValid(uint16_t index, bool valid)
+{
+    if(valid)
+    {
+        color.validBits[index >> 5] |= (uint32_t)1 << (index & 31);
+    }
+    else
+    {
+        color.validBits[index >> 5] &= ~((uint32_t)1 << (index & 31));
+    }
+}
+
+static uint32_t distanceTo(uint16_t index, uint8_t red, uint8_t green, uint8_t blue)
+{
+    int32_t dr = (int32_t)COLOR_RED(color.rgb[index]) - red;
+    int32_t dg = (int32_t)COLOR_GREEN(color.rgb[index]) - green;
+    int32_t db = (int32_t)COLOR_BLUE(color.rgb[index]) - blue;
+
+    return (dr * dr) + (dg * dg) + (db * db);
+}
+
+// Colors near cell edges and in clusters are as likely as any other
+static uint32_t randomRgb(void)
+{
+    static const uint8_t edges[] = {0, 31, 32, 33, 127, 128, 224, 255};
+
+    switch(rand() % 3)
+    {
+        case 0:
+            return COLOR_RGB(edges[rand() % 8], edges[rand() % 8], edges[rand() % 8]);
+        case 1:
+            return COLOR_RGB(100 + (rand() % 8), 40 + (rand() % 8), 200 + (rand() % 8));
+        default:
+            return COLOR_RGB(rand() % 256, rand() % 256, rand() % 256);
+    }
+}
+
+static void visitColor(uint16_t index, uint32_t distanceSquared)
+{
+    visitedTwice = visitedTwice || visited[index];
+    visited[index] = true;
+    visitedDistance[index] = distanceSquared;
+    visits++;
+}
+
+// The nearest color the linear scan finds, or NO_COLOR
+static uint16_t linearNearest(uint8_t red, uint8_t green, uint8_t blue, uint32_t* distanceSquared)
+{
+    uint16_t i, best = NO_COLOR;
+    uint32_t distance;
+
+    *distanceSquared = 0xFFFFFFFF;
+
+    for(i = 0; i < TOTAL_COLORS; i++)
+    {
+        if(isColorValid(i) && (distance = distanceTo(i, red, green, blue)) < *distanceSquared)
+        {
+            *distanceSquared = distance;
+            best = i;
+        }
+    }
+
+    return best;
+}
+
+// Returns true if the grid answers a random query as the linear scan does.
+// Ties may pick either color, at the same distance.
+static bool queryMatches(void)
+{
+    uint8_t red = rand() % 256, green = rand() % 256, blue = rand() % 256;
+    uint16_t e = (rand() % 4) ? rand() % 64 : rand() % 512, nearest, linear, count, i;
+    uint32_t distance, linearDistance;
+    bool ok;
+
+    nearest = findNearestColor(red, green, blue, &distance);
+    linear = linearNearest(red, green, blue, &linearDistance);
+    ok = (nearest == NO_COLOR) == (linear == NO_COLOR);
+    ok = ok && (linear == NO_COLOR || (distance == linearDistance && isColorValid(nearest)
+                                       && distanceTo(nearest, red, green, blue) == distance));
+
+    memset(visited, 0, sizeof(visited));
+    visits = 0;
+    visitedTwice = false;
+    count = findColorsWithin(red, green, blue, e, visitColor);
+    ok = ok && count == visits && !visitedTwice;
+
+    for(i = 0; i < TOTAL_COLORS; i++)
+    {
+        distance = isColorValid(i) ? distanceTo(i, red, green, blue) : 0xFFFFFFFF;
+        ok = ok && visited[i] == (distance < (uint32_t)e * e);
+        ok = ok && (!visited[i] || visitedDistance[i] == distance);
+    }
+
+    return ok;
+}
+
+// Learn, recolor or erase a random color, keeping the grid up to date
+static void randomEdit(void)
+{
+    uint16_t index = rand() % TOTAL_COLORS;
+
+    if(!isColorValid(index))
+    {
+        color.rgb[index] = randomRgb();
+        setValid(index, true);
+        insertColorGrid(index);
+    }
+    else if(rand() % 2)
+    {
+        removeColorGrid(index);
+        color.rgb[index] = randomRgb();
+        insertColorGrid(index);
+    }
+    else
+    {
+        removeColorGrid(index);
+        setValid(index, false);
+    }
+}
+
+//
+// Tests
+//
+
+static void testEmpty(void)
+{
+    uint32_t distance;
+
+    memset(&color, 0, sizeof(color));
+    buildColorGrid();
+
+    CHECK(findNearestColor(1, 2, 3, &distance) == NO_COLOR);
+    CHECK(findColorsWithin(1, 2, 3, 500, visitColor) == 0);
+}
+
+static void testEdits(void)
+{
+    uint32_t n;
+    bool ok = true;
+
+    for(n = 0; n < EDITS && ok; n++)
+    {
+        randomEdit();
+
+        if(n % QUERY_EVERY == 0)
+        {
+            ok = queryMatches();
+        }
+
+        // A rebuilt grid answers the same
+        if(n % (EDITS / 4) == 0)
+        {
+            buildColorGrid();
+            ok = ok && queryMatches();
+        }
+    }
+
+    CHECK(ok);
+}
+
+// Nearest and within E queries over a full library, grid and linear scan
+static void testTiming(void)
+{
+    uint32_t i, distance;
+    uint64_t gridSum = 0, linearSum = 0;
+    uint16_t index;
+    clock_t start;
+    double nearest, linear, within;
+
+    for(index = 0; index < TOTAL_COLORS; index++)
+    {
+        color.rgb[index] = COLOR_RGB(rand() % 256, rand() % 256, rand() % 256);
+        setValid(index, true);
+    }
+
+    buildColorGrid();
+    srand(32);
+
+    start = clock();
+    for(i = 0; i < TIMING_QUERIES; i++)
+    {
+        findNearestColor(rand() % 256, rand() % 256, rand() % 256, &distance);
+        gridSum += distance;
+    }
+    nearest = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    srand(32);
+
+    start = clock();
+    for(i = 0; i < TIMING_QUERIES; i++)
+    {
+        linearNearest(rand() % 256, rand() % 256, rand() % 256, &distance);
+        linearSum += distance;
+    }
+    linear = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    for(i = 0; i < TIMING_QUERIES; i++)
+    {
+        visits = 0;
+        findColorsWithin(rand() % 256, rand() % 256, rand() % 256, 20, visitColor);
+    }
+    within = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    // The same queries found the same distances
+    CHECK(gridSum == linearSum);
+
+    REPORT("%u colors: nearest %.0f ns, linear scan %.0f ns, within 20 %.0f ns per query\n", TOTAL_COLORS,
+           1e9 * nearest / TIMING_QUERIES, 1e9 * linear / TIMING_QUERIES, 1e9 * within / TIMING_QUERIES);
+}
+
+int main(void)
+{
+    char name[24];
+
+    srand(32);
+
+    testEmpty();
+    testEdits();
+    testTiming();
+
+    sprintf(name, "grid %u colors", TOTAL_COLORS);
+
+    return testResult(name);
+}
@@ -0,0 +1,80 @@
+// host.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// TI compiler intrinsics for host tests, tracking PRIMASK and BASEPRI, and
+// the registers of the stand-in device header
+
+#include <stdint.h>
+#include <string.h>
+#include "host.h"
+
+#define HOST_REGISTER(name) volatile uint32_t name
+#include "tm4c123gh6pm.h"
+
+volatile uint32_t hostNvicPri[35];
+
+uint32_t hostPrimask = 0;
+uint32_t hostBasepri = 0;
+void (*hostPreempt)(void) = 0;
+void (*hostWfi)(void) = 0;
+
+// Give a pending interrupt its chance once nothing masks it
+static void unmasked(void)
+{
+    if(hostPrimask == 0 && hostBasepri == 0 && hostPreempt != 0)
+    {
+        hostPreempt();
+    }
+}
+
+uint32_t _disable_interrupts(void)
+{
+    uint32_t state = hostPrimask;
+
+    hostPrimask = 1;
+
+    return state;
+}
+
+uint32_t _enable_interrupts(void)
+{
+    uint32_t state = hostPrimask;
+
+    hostPrimask = 0;
+    unmasked();
+
+    return state;
+}
+
+void _restore_interrupts(uint32_t state)
+{
+    hostPrimask = state;
+    unmasked();
+}
+
+uint32_t _set_interrupt_priority(uint32_t priority)
+{
+    uint32_t state = hostBasepri;
+
+    hostBasepri = priority;
+    unmasked();
+
+    return state;
+}
+
+void hostAsm(const char* code)
+{
+    if(strstr(code, "WFI") != 0 && hostWfi != 0)
+    {
+        hostWfi();
+    }
+}
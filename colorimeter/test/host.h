@@ -0,0 +1,42 @@
+// host.h
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// Forced into every host test build with -include. Declares the TI compiler
+// intrinsics the firmware calls, host.c implements them.
+
+#ifndef HOST_H_
+#define HOST_H_
+
+#include <stdint.h>
+
+#define __asm(code) hostAsm(code)
+#define _delay_cycles(cycles) ((void)(cycles))
+
+uint32_t _disable_interrupts(void);
+uint32_t _enable_interrupts(void);
+void _restore_interrupts(uint32_t state);
+uint32_t _set_interrupt_priority(uint32_t priority);
+
+// Interrupt mask state seen by the firmware, for tests to check
+extern uint32_t hostPrimask;
+extern uint32_t hostBasepri;
+
+// Called whenever the firmware unmasks interrupts, where a pending interrupt
+// would preempt it. A test sets it to run its simulated ISRs.
+extern void (*hostPreempt)(void);
+
+// Inline assembly does nothing, except that a WFI calls hostWfi if a test
+// set it, to advance its simulated clock to the next interrupt
+void hostAsm(const char* code);
+extern void (*hostWfi)(void);
+
+#endif /* HOST_H_ */
@@ -0,0 +1,247 @@
+// interruptsTest.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// Priority plan and deferred work queue: FIFO order, coalescing of work already waiting, the
+// full queue drop, and PendSV draining the queue in order, work posted by
+// work included. BASEPRI masks only ever get stricter while nested.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test.h"
+#include "tm4c123gh6pm.h"
+#include "cycles.h"
+#include "interrupts.h"
+
+#define MAX_RUNS 100
+
+static uint32_t now = 0;                        // simulated cycle counter
+static uint8_t order[MAX_RUNS];                 // work items in the order they ran
+static uint8_t runs = 0;
+
+//
+// Fakes
+//
+
+uint32_t readCycleCounter(void) { return now += 7; }
+uint32_t cyclesToMicroseconds(uint32_t cycles) { return cycles / CYCLES_PER_MICROSECOND; }
+void sendUart0String(char str[]) {}
+void sendUart0Unsigned(uint32_t value) {}
+void sendUart0Fixed(int32_t value, uint8_t decimals) {}
+
+//
+// Helpers
+//
+
+static void ran(uint8_t item)
+{
+    if(runs < MAX_RUNS)
+    {
+        order[runs++] = item;
+    }
+}
+
+static void work0(void) { ran(0); }
+static void work1(void) { ran(1); }
+static void work2(void) { ran(2); }
+static void work3(void) { ran(3); }
+static void work4(void) { ran(4); }
+static void work5(void) { ran(5); }
+static void work6(void) { ran(6); }
+static void work7(void) { ran(7); }
+static void work8(void) { ran(8); }
+
+static const DEFERRED_WORK works[] = {work0, work1, work2, work3, work4, work5, work6, work7, work8};
+
+// Work that posts more work while PendSV runs it
+static void postingWork(void)
+{
+    ran(9);
+    deferWork(work1);
+    deferWork(work2);
+}
+
+// Priority byte of a peripheral interrupt as initInterrupts() wrote it
+static uint8_t priorityOf(uint8_t vector)
+{
+    return ((volatile uint8_t *)&NVIC_PRI0_R)[vector - 16] >> PRIORITY_SHIFT;
+}
+
+//
+// Tests
+//
+
+static void testPlan(void)
+{
+    NVIC_SYS_PRI3_R = 0;
+    initInterrupts();
+
+    CHECK(priorityOf(INT_ADC0SS3) == PRIORITY_ADC0 && priorityOf(INT_UART0) == PRIORITY_UART0);
+    CHECK(priorityOf(INT_TIMER1A) == PRIORITY_TIMER1 && priorityOf(INT_TIMER2A) == PRIORITY_TIMER2);
+    CHECK(priorityOf(INT_GPIOF) == PRIORITY_GPIOF && priorityOf(INT_WTIMER0A) == PRIORITY_WTIMER0);
+    CHECK(NVIC_SYS_PRI3_R == ((PRIORITY_PENDSV << NVIC_SYS_PRI3_PENDSV_S) | (PRIORITY_SYSTICK << NVIC_SYS_PRI3_TICK_S)));
+}
+
+static void testOrderAndCoalescing(void)
+{
+    DEFER_QUEUE queue = {0};
+    DEFERRED_WORK work;
+    uint32_t posted;
+
+    CHECK(postWork(&queue, work1, 1) && postWork(&queue, work2, 2) && postWork(&queue, work1, 3));
+    CHECK(queue.count == 2 && queue.coalesced == 1);
+
+    // A coalesced post keeps the original post time
+    CHECK(takeWork(&queue, &work, &posted) && work == work1 && posted == 1);
+
+    // Taken work can be posted again, behind what is waiting
+    CHECK(postWork(&queue, work1, 4));
+    CHECK(takeWork(&queue, &work, &posted) && work == work2 && posted == 2);
+    CHECK(takeWork(&queue, &work, &posted) && work == work1 && posted == 4);
+    CHECK(!takeWork(&queue, &work, &posted));
+    CHECK(queue.runs == 3 && queue.maxCount == 2);
+}
+
+static void testFullQueue(void)
+{
+    DEFER_QUEUE queue = {0};
+    uint8_t i;
+
+    for(i = 0; i < MAX_DEFERRED; i++)
+    {
+        CHECK(postWork(&queue, works[i], i));
+    }
+
+    CHECK(!postWork(&queue, works[MAX_DEFERRED], 0));
+    CHECK(queue.dropped == 1 && queue.count == MAX_DEFERRED);
+
+    // Work already waiting still coalesces into a full queue
+    CHECK(postWork(&queue, works[0], 0) && queue.dropped == 1);
+}
+
+// Random posts and takes against a model of the queue
+static void testRandomSteps(void)
+{
+    DEFER_QUEUE queue = {0};
+    DEFERRED_WORK model[MAX_DEFERRED], work;
+    uint8_t count = 0, i, j;
+    uint32_t step, posted;
+    bool ok = true, waiting;
+
+    for(step = 0; step < 1000; step++)
+    {
+        if(rand() % 2)
+        {
+            work = works[rand() % 9];
+
+            for(i = 0, waiting = false; i < count; i++)
+            {
+                waiting = waiting || model[i] == work;
+            }
+
+            ok = ok && postWork(&queue, work, step) == (waiting || count < MAX_DEFERRED);
+
+            if(!waiting && count < MAX_DEFERRED)
+            {
+                model[count++] = work;
+            }
+        }
+        else if(count > 0)
+        {
+            ok = ok && takeWork(&queue, &work, &posted) && work == model[0];
+            memmove(model, &model[1], --count * sizeof(model[0]));
+        }
+        else
+        {
+            ok = ok && !takeWork(&queue, &work, &posted);
+        }
+
+        ok = ok && queue.count == count;
+
+        for(i = 0; i < queue.count; i++)
+        {
+            for(j = i + 1; j < queue.count; j++)
+            {
+                ok = ok && queue.work[(queue.head + i) % MAX_DEFERRED] != queue.work[(queue.head + j) % MAX_DEFERRED];
+            }
+        }
+    }
+
+    CHECK(ok);
+}
+
+static void testPendSv(void)
+{
+    uint8_t i;
+    bool ok = true;
+
+    memset(&deferQueue, 0, sizeof(deferQueue));
+    NVIC_INT_CTRL_R = 0;
+
+    for(i = 0; i < MAX_DEFERRED; i++)
+    {
+        deferWork(works[i]);
+    }
+
+    CHECK(NVIC_INT_CTRL_R & NVIC_INT_CTRL_PEND_SV);
+    CHECK(hostPrimask == 0);
+
+    runs = 0;
+    pendSvIsr();
+
+    for(i = 0; i < MAX_DEFERRED; i++)
+    {
+        ok = ok && order[i] == i;
+    }
+
+    CHECK(runs == MAX_DEFERRED && ok && deferQueue.count == 0);
+    CHECK(interruptStats.deferLatency > 0 && interruptStats.deferCycles > 0);
+
+    // Work posted by work runs in the same pass
+    runs = 0;
+    deferWork(postingWork);
+    pendSvIsr();
+    CHECK(runs == 3 && order[0] == 9 && order[1] == 1 && order[2] == 2);
+}
+
+static void testMasks(void)
+{
+    uint32_t outer, inner;
+
+    outer = maskInterrupts(PRIORITY_TIMER1);
+    CHECK(outer == 0 && hostBasepri == PRIORITY_TIMER1 << PRIORITY_SHIFT);
+
+    // A looser mask inside keeps the stricter one
+    inner = maskInterrupts(PRIORITY_GPIOF);
+    CHECK(hostBasepri == PRIORITY_TIMER1 << PRIORITY_SHIFT);
+
+    unmaskInterrupts(inner);
+    CHECK(hostBasepri == PRIORITY_TIMER1 << PRIORITY_SHIFT);
+
+    unmaskInterrupts(outer);
+    CHECK(hostBasepri == 0);
+}
+
+int main(void)
+{
+    srand(44);
+
+    testPlan();
+    testOrderAndCoalescing();
+    testFullQueue();
+    testRandomSteps();
+    testPendSv();
+    testMasks();
+
+    return testResult("interrupts");
+}
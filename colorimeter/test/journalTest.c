@@ -0,0 +1,373 @@
+// journalTest.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// Journal over a simulated EEPROM: records are packed in two words, every
+// key fits at once, and records survive a remount, wrapping the ring many
+// times, and a power cut at any write. A cut can tear the word being written,
+// leaving only its low half.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <setjmp.h>
+#include "test.h"
+#include "eeprom.h"
+#include "journal.h"
+
+#define EEPROM_WORDS (32 * EEPROM_BLOCK_WORDS)
+#define NO_VALUE     0xFFFFFFFF
+
+static uint32_t eeprom[EEPROM_WORDS];
+static uint32_t wordsRead = 0;
+static uint32_t wordsWritten = 0;
+static int32_t writesLeft = -1;                 // writes before the power cut, -1 never
+static bool tearWord = false;
+static jmp_buf powerCut;
+
+// Journal contents expected after a remount, NO_VALUE for no record
+static uint32_t expected[JOURNAL_KEYS];
+static uint32_t mounted[JOURNAL_KEYS];
+
+//
+// Fakes
+//
+
+uint32_t readEeprom(uint16_t add)
+{
+    wordsRead++;
+
+    return eeprom[add];
+}
+
+void readEepromWords(uint16_t add, uint32_t data[], uint16_t count)
+{
+    while(count--)
+    {
+        *data++ = readEeprom(add++);
+    }
+}
+
+void writeEeprom(uint16_t add, uint32_t data)
+{
+    if(writesLeft == 0)
+    {
+        if(tearWord)
+        {
+            eeprom[add] = (eeprom[add] & 0xFFFF0000) | (data & 0xFFFF);
+        }
+
+        longjmp(powerCut, 1);
+    }
+
+    if(writesLeft > 0)
+    {
+        writesLeft--;
+    }
+
+    eeprom[add] = data;
+    wordsWritten++;
+}
+
+void sendUart0String(char str[]) {}
+void sendUart0Unsigned(uint32_t value) {}
+void sendUart0Fixed(int32_t value, uint8_t decimals) {}
+uint32_t readCycleCounter(void) { return 0; }
+uint32_t cyclesToMicroseconds(uint32_t cycles) { return cycles; }
+
+//
+// Helpers
+//
+
+// The data halfword is always the complement of the low half of the data
+// word, 0 marks a mismatch
+static void visitRecord(uint16_t key, uint16_t first, uint32_t second)
+{
+    mounted[key] = (first == (uint16_t)~second) ? second : 0;
+}
+
+// Mount and compare every key with expected
+static bool mountMatches(void)
+{
+    memset(mounted, 0xFF, sizeof(mounted));
+
+    return mountJournal(visitRecord) && memcmp(mounted, expected, sizeof(mounted)) == 0;
+}
+
+static void putValue(uint16_t key, uint32_t value)
+{
+    if(value == NO_VALUE)
+    {
+        eraseJournal(key);
+    }
+    else
+    {
+        writeJournal(key, ~value, value);
+    }
+}
+
+static void startJournal(void)
+{
+    memset(eeprom, 0xFF, sizeof(eeprom));
+    memset(expected, 0xFF, sizeof(expected));
+    formatJournal();
+}
+
+//
+// Tests
+//
+
+// A record is its key word and data word, right after the block header
+static void testPacked(void)
+{
+    uint32_t keyWord, dataWord;
+    uint8_t bit;
+    bool detected = true;
+
+    CHECK(JOURNAL_SLOTS == 7 && JOURNAL_CAPACITY >= JOURNAL_KEYS);
+
+    startJournal();
+    writeJournal(5, 0x1234, 0xABCDEF);
+    writeJournal(6, 1, 2);
+    eraseJournal(6);
+
+    keyWord = eeprom[1];
+    dataWord = eeprom[2];
+    CHECK((keyWord >> 23) == 5 && (keyWord & 0xFFFF) == 0x1234 && dataWord == 0xABCDEF);
+    CHECK((eeprom[5] >> 23) == (6 | JOURNAL_TOMBSTONE));
+    CHECK(eeprom[7] == JOURNAL_EMPTY);
+
+    // Every single bit flip of the record is caught by its CRC
+    for(bit = 0; bit < 64; bit++)
+    {
+        if(bit < 32)
+        {
+            eeprom[1] = keyWord ^ ((uint32_t)1 << bit);
+        }
+        else
+        {
+            eeprom[2] = dataWord ^ ((uint32_t)1 << (bit - 32));
+        }
+
+        memset(mounted, 0xFF, sizeof(mounted));
+        detected = detected && mountJournal(visitRecord) && mounted[5] == NO_VALUE;
+
+        eeprom[1] = keyWord;
+        eeprom[2] = dataWord;
+    }
+
+    CHECK(detected);
+}
+
+static void testRemount(void)
+{
+    uint16_t key;
+
+    startJournal();
+    CHECK(mountMatches());
+
+    for(key = 0; key < 40; key++)
+    {
+        expected[key] = key * 0x01010101;
+        putValue(key, expected[key]);
+    }
+
+    expected[7] = NO_VALUE;
+    putValue(7, NO_VALUE);
+    expected[KEY_SETTINGS] = 0x1234;
+    putValue(KEY_SETTINGS, 0x1234);
+
+    CHECK(mountMatches());
+    CHECK(countJournal() == 40 + 1);
+
+    // Appending carries on from where the mount left off
+    expected[3] = 0xABCDEF;
+    putValue(3, 0xABCDEF);
+    CHECK(mountMatches());
+}
+
+// Rewrite a full journal until the ring has wrapped many times
+static void testWrap(void)
+{
+    uint32_t i;
+    uint16_t key;
+    bool ok = true;
+
+    startJournal();
+
+    for(key = 0; key < TOTAL_COLORS; key++)
+    {
+        expected[key] = key;
+        putValue(key, key);
+    }
+
+    // Calibration and settings still fit with the library full
+    CHECK(writeJournal(KEY_CALIBRATION, ~1, 1) && writeJournal(KEY_SETTINGS, ~2, 2));
+    CHECK(countJournal() == JOURNAL_KEYS);
+
+    startJournal();
+
+    for(i = 0; i < 10000; i++)
+    {
+        key = rand() % JOURNAL_KEYS;
+        expected[key] = (rand() % 4 == 0) ? NO_VALUE : i;
+        putValue(key, expected[key]);
+
+        if(i % 500 == 0)
+        {
+            ok = ok && mountMatches();
+        }
+    }
+
+    CHECK(ok);
+    CHECK(mountMatches());
+}
+
+// Cut the power at every write of random appends. The remount must find each
+// key as it was before the append, or for the key appended as it was after.
+static void testPowerCut(void)
+{
+    uint32_t i, value, before;
+    uint16_t key, other;
+    bool ok = true;
+
+    startJournal();
+
+    for(i = 0; i < 10000; i++)
+    {
+        key = rand() % JOURNAL_KEYS;
+        value = (rand() % 3 == 0) ? NO_VALUE : i;
+        before = expected[key];
+        writesLeft = rand() % 8;
+        tearWord = rand() % 2;
+
+        if(!setjmp(powerCut))
+        {
+            putValue(key, value);
+            writesLeft = -1;
+            expected[key] = value;
+            continue;
+        }
+
+        writesLeft = -1;
+
+        memset(mounted, 0xFF, sizeof(mounted));
+        ok = ok && mountJournal(visitRecord);
+
+        for(other = 0; other < JOURNAL_KEYS; other++)
+        {
+            if(other != key && mounted[other] != expected[other])
+            {
+                ok = false;
+            }
+        }
+
+        ok = ok && (mounted[key] == before || mounted[key] == value);
+        expected[key] = mounted[key];
+
+        // A mount that finished a cut compaction keeps an exact count
+        ok = ok && countJournal() <= JOURNAL_CAPACITY;
+    }
+
+    CHECK(ok);
+    CHECK(mountMatches());
+}
+
+// Erases compacted by the mount after a cut must not wrap the erased count,
+// which would have makeRoom() reclaim the whole ring or refuse a key
+static void testCutCompactionWithErases(void)
+{
+    uint16_t key;
+    uint32_t i;
+    bool ok = true;
+
+    for(i = 0; i < 300; i++)
+    {
+        startJournal();
+
+        for(key = 0; key < 60; key++)
+        {
+            expected[key] = NO_VALUE;
+            putValue(key, key);
+            putValue(key, NO_VALUE);
+        }
+
+        writesLeft = rand() % 200;
+        tearWord = rand() % 2;
+
+        if(!setjmp(powerCut))
+        {
+            for(key = 60; key < JOURNAL_KEYS; key++)
+            {
+                putValue(key, key);
+            }
+        }
+
+        writesLeft = -1;
+
+        ok = ok && mountJournal(visitRecord) && countJournal() <= JOURNAL_CAPACITY;
+
+        // Every key still fits, and the count is exact once all are written
+        for(key = 0; key < JOURNAL_KEYS; key++)
+        {
+            ok = ok && writeJournal(key, ~key, key);
+        }
+
+        ok = ok && countJournal() == JOURNAL_KEYS;
+
+        // Rewriting the same records writes nothing
+        wordsWritten = 0;
+
+        for(key = 0; key < JOURNAL_KEYS; key++)
+        {
+            ok = ok && writeJournal(key, ~key, key);
+        }
+
+        ok = ok && wordsWritten == 0;
+    }
+
+    CHECK(ok);
+}
+
+// The mount reads key words, and only the latest records in full
+static void testMountReads(void)
+{
+    uint16_t key;
+
+    startJournal();
+
+    for(key = 0; key < 20; key++)
+    {
+        expected[key] = key;
+        putValue(key, key);
+        putValue(key, key + 1);
+        expected[key] = key + 1;
+    }
+
+    wordsRead = 0;
+    CHECK(mountMatches());
+    CHECK(wordsRead < (JOURNAL_BLOCKS * 2) + (JOURNAL_BLOCKS * JOURNAL_SLOTS) + (JOURNAL_KEYS * 2) + (20 * JOURNAL_RECORD_WORDS));
+}
+
+int main(void)
+{
+    srand(39);
+
+    testPacked();
+    testRemount();
+    testWrap();
+    testPowerCut();
+    testCutCompactionWithErases();
+    testMountReads();
+
+    return testResult("journal");
+}
@@ -0,0 +1,275 @@
+// labTest.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// CIELAB conversion against a double precision reference. Every triplet of
+// the RGB cube is converted through the gamma, matrix and cube root tables,
+// and the worst CIE76 difference from the sRGB / D65 formulas is reported and
+// must stay below MAX_ERROR. Color differences and the within E search must
+// agree with the same reference. The cost of a conversion and a comparison is
+// reported.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "test.h"
+#include "eeprom.h"
+#include "grid.h"
+#include "lab.h"
+
+#define MAX_ERROR      1.0                      // worst CIE76 error allowed, well below a just noticeable difference
+#define RANDOM_PAIRS   100000
+#define TIMING_ROUNDS  1000000
+
+static double linear[256];                      // sRGB channel value to linear intensity
+static bool visited[TOTAL_COLORS];
+static uint16_t visits = 0;
+
+//
+// Fakes
+//
+
+STORED_COLORS color;
+
+bool isColorValid(uint16_t index)
+{
+    return (color.validBits[index >> 5] >> (index & 31)) & 1;
+}
+
+//
+// Helpers
+//
+
+static void buildLinear(void)
+{
+    double c;
+    uint16_t i;
+
+    for(i = 0; i < 256; i++)
+    {
+        c = i / 255.0;
+        linear[i] = (c <= 0.04045) ? c / 12.92 : pow((c + 0.055) / 1.055, 2.4);
+    }
+}
+
+static double labFunctionReference(double t)
+{
+    const double delta = 6.0 / 29.0;
+
+    return (t > delta * delta * delta) ? cbrt(t) : (t / (3 * delta * delta)) + (4.0 / 29.0);
+}
+
+// sRGB to L*, a*, b*, D65 white
+static void labReference(uint8_t red, uint8_t green, uint8_t blue, double lab[3])
+{
+    const double r = linear[red], g = linear[green], b = linear[blue];
+    double fx, fy, fz;
+
+    fx = labFunctionReference(((0.4124564 * r) + (0.3575761 * g) + (0.1804375 * b)) / 0.95047);
+    fy = labFunctionReference((0.2126729 * r) + (0.7151522 * g) + (0.0721750 * b));
+    fz = labFunctionReference(((0.0193339 * r) + (0.1191920 * g) + (0.9503041 * b)) / 1.08883);
+
+    lab[0] = (116 * fy) - 16;
+    lab[1] = 500 * (fx - fy);
+    lab[2] = 200 * (fy - fz);
+}
+
+static double deltaE76(const double first[3], const double second[3])
+{
+    return sqrt(((first[0] - second[0]) * (first[0] - second[0])) + ((first[1] - second[1]) * (first[1] - second[1]))
+                + ((first[2] - second[2]) * (first[2] - second[2])));
+}
+
+static void labToDouble(const int16_t lab[3], double result[3])
+{
+    uint8_t i;
+
+    for(i = 0; i < 3; i++)
+    {
+        result[i] = (double)lab[i] / (1 << LAB_SHIFT);
+    }
+}
+
+static void visitColor(uint16_t index, uint32_t distanceSquared)
+{
+    visited[index] = true;
+    visits++;
+}
+
+//
+// Tests
+//
+
+// The whole RGB cube, the worst and mean error are reported
+static void testCube(void)
+{
+    int16_t lab[3];
+    double fixed[3], reference[3], error, worst = 0, sum = 0;
+    uint32_t red, green, blue, worstRgb = 0;
+
+    for(red = 0; red < 256; red++)
+    {
+        for(green = 0; green < 256; green++)
+        {
+            for(blue = 0; blue < 256; blue++)
+            {
+                rgbToLab(red, green, blue, lab);
+                labToDouble(lab, fixed);
+                labReference(red, green, blue, reference);
+                error = deltaE76(fixed, reference);
+                sum += error;
+
+                if(error > worst)
+                {
+                    worst = error;
+                    worstRgb = COLOR_RGB(red, green, blue);
+                }
+            }
+        }
+    }
+
+    CHECK(worst < MAX_ERROR);
+
+    REPORT("RGB cube: worst error %.3f at %u,%u,%u, mean error %.3f\n", worst,
+           COLOR_RED(worstRgb), COLOR_GREEN(worstRgb), COLOR_BLUE(worstRgb), sum / (1 << 24));
+}
+
+// Black and white land on the ends of L* with no chroma
+static void testWhitePoint(void)
+{
+    int16_t lab[3];
+
+    rgbToLab(0, 0, 0, lab);
+    CHECK(lab[0] == 0 && lab[1] == 0 && lab[2] == 0);
+
+    rgbToLab(255, 255, 255, lab);
+    CHECK(abs(lab[0] - (100 << LAB_SHIFT)) <= 1 && abs(lab[1]) <= 1 && abs(lab[2]) <= 1);
+}
+
+// Differences between random colors follow the reference within twice the
+// conversion error
+static void testDifferences(void)
+{
+    int16_t first[3], second[3];
+    double a[3], b[3], fixed, reference, worst = 0;
+    uint8_t rgb[6], i;
+    uint32_t n;
+
+    for(n = 0; n < RANDOM_PAIRS; n++)
+    {
+        for(i = 0; i < 6; i++)
+        {
+            rgb[i] = rand() % 256;
+        }
+
+        rgbToLab(rgb[0], rgb[1], rgb[2], first);
+        rgbToLab(rgb[3], rgb[4], rgb[5], second);
+        labReference(rgb[0], rgb[1], rgb[2], a);
+        labReference(rgb[3], rgb[4], rgb[5], b);
+
+        fixed = sqrt((double)deltaE76Squared(first, second)) / (1 << LAB_SHIFT);
+        reference = deltaE76(a, b);
+        worst = (fabs(fixed - reference) > worst) ? fabs(fixed - reference) : worst;
+    }
+
+    CHECK(worst < 2 * MAX_ERROR);
+
+    REPORT("color differences: worst error %.3f\n", worst);
+}
+
+// The within E search visits exactly the colors closer than E
+static void testWithin(void)
+{
+    int16_t sample[3], reference[3];
+    uint16_t index, e, count;
+    uint8_t red, green, blue;
+    uint32_t n, limit;
+    bool ok = true;
+
+    memset(&color, 0, sizeof(color));
+
+    for(index = 0; index < TOTAL_COLORS; index += 2)
+    {
+        color.rgb[index] = COLOR_RGB(rand() % 256, rand() % 256, rand() % 256);
+        color.validBits[index >> 5] |= (uint32_t)1 << (index & 31);
+        updateColorLab(index);
+    }
+
+    for(n = 0; n < 1000 && ok; n++)
+    {
+        red = rand() % 256;
+        green = rand() % 256;
+        blue = rand() % 256;
+        e = rand() % 60;
+        limit = ((uint32_t)e * e) << (2 * LAB_SHIFT);
+
+        memset(visited, 0, sizeof(visited));
+        visits = 0;
+        count = findLabColorsWithin(red, green, blue, e, visitColor);
+        ok = count == visits;
+
+        rgbToLab(red, green, blue, sample);
+
+        for(index = 0; index < TOTAL_COLORS; index++)
+        {
+            rgbToLab(COLOR_RED(color.rgb[index]), COLOR_GREEN(color.rgb[index]), COLOR_BLUE(color.rgb[index]), reference);
+            ok = ok && visited[index] == (isColorValid(index) && deltaE76Squared(sample, reference) < limit);
+        }
+    }
+
+    CHECK(ok);
+}
+
+// Report the cost of a conversion and a comparison
+static void testTiming(void)
+{
+    int16_t lab[1024][3];
+    uint32_t i, sum = 0;
+    clock_t start;
+    double convert, compare;
+
+    start = clock();
+    for(i = 0; i < TIMING_ROUNDS; i++)
+    {
+        rgbToLab(i, i >> 8, i >> 16, lab[i & 1023]);
+    }
+    convert = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    for(i = 0; i < TIMING_ROUNDS; i++)
+    {
+        sum += deltaE76Squared(lab[i & 1023], lab[(i * 7) & 1023]);
+    }
+    compare = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    CHECK(sum > 0);
+
+    REPORT("rgbToLab %.1f ns, deltaE76Squared %.1f ns per call\n",
+           1e9 * convert / TIMING_ROUNDS, 1e9 * compare / TIMING_ROUNDS);
+}
+
+int main(void)
+{
+    srand(33);
+    buildLinear();
+
+    testCube();
+    testWhitePoint();
+    testDifferences();
+    testWithin();
+    testTiming();
+
+    return testResult("lab");
+}
@@ -0,0 +1,257 @@
+// ledTest.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// LED ramp capture against a full Tx ring. Every character sent waits for
+// the UART to shift one out, so output costs simulated time. The readings of
+// each ramp step must still be RAMP_SPEED apart and come at the same times
+// whether the table is printed or not and in either format, with no output
+// between them, and the table printed afterwards must hold the readings.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include "test.h"
+#include "uart0.h"
+#include "gpio.h"
+#include "eeprom.h"
+#include "grid.h"
+#include "lab.h"
+#include "model.h"
+#include "rank.h"
+#include "stable.h"
+#include "cache.h"
+#include "logger.h"
+#include "tasks.h"
+#include "timers.h"
+#include "interrupts.h"
+#include "timestamp.h"
+#include "stats.h"
+#include "led.h"
+
+#define CHARACTER_TIME 87                       // us to shift out a character at 115200 baud
+#define MAX_STEPS      (3 * 1024)
+
+static uint64_t now = 0;                        // simulated time in us
+static uint32_t sent = 0;                       // characters sent
+static char output[4096];
+static uint16_t outputLength = 0;
+static uint16_t level[3];                       // LED levels set
+
+// Time and characters sent at each reading
+static uint64_t stepTime[MAX_STEPS];
+static uint32_t stepSent[MAX_STEPS];
+static uint16_t steps = 0;
+
+//
+// Fakes
+//
+
+STORED_COLORS color;
+MATCH_CACHE matchCache;
+STABILIZER stable;
+SCHEDULER scheduler;
+bool calibrateMode = false;
+bool validCalibration = false;
+bool logMode = false;
+int threshold = 0;
+uint8_t matchMetric = 0;
+uint8_t rankSize = 0;
+
+// The ring is full, each character waits for one to shift out
+void sendUart0String(char str[])
+{
+    uint16_t length = strlen(str);
+
+    now += (uint64_t)length * CHARACTER_TIME;
+    sent += length;
+
+    if(outputLength + length < sizeof(output))
+    {
+        strcpy(&output[outputLength], str);
+        outputLength += length;
+    }
+}
+
+void sendUart0StringLiteral(const char str[])
+{
+    sendUart0String((char*)str);
+}
+
+void setRgbColor(uint16_t red, uint16_t green, uint16_t blue)
+{
+    level[0] = red;
+    level[1] = green;
+    level[2] = blue;
+}
+
+void waitMicrosecond(uint32_t us)
+{
+    now += us;
+}
+
+// The sensor reads 100 plus three counts per step of the lit LED
+uint16_t readRawResult(void)
+{
+    if(steps < MAX_STEPS)
+    {
+        stepTime[steps] = now;
+        stepSent[steps++] = sent;
+    }
+
+    return 100 + (3 * (level[0] + level[1] + level[2]));
+}
+
+uint64_t readTimestamp(void) { return now; }
+uint32_t readCycleCounter(void) { return 0; }
+void countStat(uint8_t stat) {}
+void recordProbe(uint8_t probe, uint32_t cycles) {}
+void setPinValue(PORT port, uint8_t pin, bool value) {}
+uint32_t deadlineAfter(uint32_t us) { return 0; }
+bool deferWork(DEFERRED_WORK work) { return true; }
+void setAlarm(uint32_t deadline, ALARM_HANDLER handler) {}
+void startTaskTimer(SCHEDULER* s, TASK_TIMER* timer, uint8_t id, uint32_t delay, uint32_t period) {}
+void sendUart0Stamp(uint64_t time, char separator) {}
+uint16_t findColorsWithin(uint8_t red, uint8_t green, uint8_t blue, uint16_t e, GRID_VISITOR visitor) { return 0; }
+uint16_t findLabColorsWithin(uint8_t red, uint8_t green, uint8_t blue, uint16_t e, GRID_VISITOR visitor) { return 0; }
+uint16_t findNearestColor(uint8_t red, uint8_t green, uint8_t blue, uint32_t* distanceSquared) { return NO_COLOR; }
+bool logSample(uint32_t time, uint16_t red, uint16_t green, uint16_t blue) { return true; }
+bool lookupMatchCache(MATCH_CACHE* cache, uint8_t red, uint8_t green, uint8_t blue, uint8_t size, RANKING* ranking) { return false; }
+void storeMatchCache(MATCH_CACHE* cache, uint8_t red, uint8_t green, uint8_t blue, uint8_t size, const RANKING* ranking) {}
+uint32_t mahalanobisSquared(uint16_t model, uint32_t rgb, uint8_t red, uint8_t green, uint8_t blue) { return 0; }
+uint8_t modelConfidence(uint32_t distanceSquared) { return 0; }
+void resetRanking(RANKING* ranking, uint8_t size) {}
+void offerRanking(RANKING* ranking, uint16_t index, uint32_t distanceSquared, uint8_t confidence) {}
+void sortRanking(RANKING* ranking) {}
+void printRanking(RANKING* ranking, uint8_t shift, uint64_t time) {}
+bool updateStabilizer(STABILIZER* stabilizer, uint16_t label) { return false; }
+
+//
+// Helpers
+//
+
+static void clearOutput(void)
+{
+    outputLength = 0;
+    output[0] = 0;
+}
+
+// Run the LED test, returns the time it took
+static uint64_t runTest(bool print, uint8_t format)
+{
+    uint64_t start = now;
+
+    printTest = print;
+    rampFormat = format;
+    steps = 0;
+    sent = 0;
+    clearOutput();
+
+    testLED();
+
+    return now - start;
+}
+
+// Returns true if the readings since the last run are RAMP_SPEED apart with
+// nothing sent after the first
+static bool stepsEven(void)
+{
+    uint16_t i;
+    bool ok = steps == 3 * 1024;
+
+    for(i = 1; ok && i < steps; i++)
+    {
+        ok = stepTime[i] - stepTime[i - 1] == RAMP_SPEED && stepSent[i] == stepSent[0];
+    }
+
+    return ok;
+}
+
+//
+// Tests
+//
+
+// Printing the table, in either format, changes nothing about the readings
+static void testTiming(void)
+{
+    uint64_t quiet, csv, delta, times[MAX_STEPS];
+    uint32_t quietSent, csvSent;
+    uint16_t i;
+    bool same = true;
+
+    quiet = runTest(false, RAMP_CSV);
+    quietSent = sent;
+    CHECK(stepsEven());
+
+    for(i = 0; i < steps; i++)
+    {
+        times[i] = stepTime[i] - stepTime[0];
+    }
+
+    csv = runTest(true, RAMP_CSV);
+    csvSent = sent;
+    CHECK(stepsEven());
+
+    for(i = 0; i < steps; i++)
+    {
+        same = same && stepTime[i] - stepTime[0] == times[i];
+    }
+
+    delta = runTest(true, RAMP_DELTA);
+    CHECK(stepsEven());
+
+    for(i = 0; i < steps; i++)
+    {
+        same = same && stepTime[i] - stepTime[0] == times[i];
+    }
+
+    CHECK(same);
+
+    // The table costs its characters after the last reading, and the delta
+    // format sends far fewer of them
+    CHECK(quietSent == strlen("  wait....\r\n"));
+    CHECK(csv == quiet + ((uint64_t)(csvSent - quietSent) * CHARACTER_TIME));
+    CHECK(delta == quiet + ((uint64_t)(sent - quietSent) * CHARACTER_TIME));
+    CHECK(sent < csvSent / 2);
+
+    REPORT("ramp %llu ms, with the CSV table %llu ms, with the delta table %llu ms\n",
+           (unsigned long long)quiet / 1000, (unsigned long long)csv / 1000, (unsigned long long)delta / 1000);
+}
+
+// A calibration stops each ramp past the threshold, the table holds what was read
+static void testTable(void)
+{
+    calibrateMode = true;
+    threshold = 130;
+    runTest(true, RAMP_CSV);
+    calibrateMode = false;
+
+    CHECK(rampLength[0] == 11 && rampLength[1] == 11 && rampLength[2] == 11);
+    CHECK(rgbLeds[0] == 10 && rgbLeds[1] == 10 && rgbLeds[2] == 10);
+    CHECK(strstr(output, "  wait....\r\n  0,100\r\n  1,103\r\n") == output);
+    CHECK(strstr(output, "  10,130\r\n  0,100\r\n") != 0);
+
+    clearOutput();
+    rampFormat = RAMP_DELTA;
+    printRampTable();
+    CHECK(strcmp(output, "  red,11\r\n  100,3,3,3,3,3,3,3,3,3,3\r\n"
+                         "  green,11\r\n  100,3,3,3,3,3,3,3,3,3,3\r\n"
+                         "  blue,11\r\n  100,3,3,3,3,3,3,3,3,3,3\r\n") == 0);
+}
+
+int main(void)
+{
+    testTiming();
+    testTable();
+
+    return testResult("led");
+}
@@ -0,0 +1,278 @@
+// loggerTest.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// Measurement log over a simulated flash region of LOG_TEST_PAGES pages, set
+// by the Makefile: samples read back in order across ring wraps, a power cut
+// loses only the samples not yet programmed, and no word is programmed twice.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test.h"
+#include "logger.h"
+
+#define LOG_WORDS    (LOG_TEST_PAGES * LOG_PAGE_WORDS)
+#define MAX_SAMPLES  200000
+
+// The log region, its bounds come from the Makefile like tm4c123gh6pm.cmd
+uint8_t __LOG_START[LOG_TEST_PAGES * FLASH_PAGE_SIZE];
+
+static uint32_t flash[LOG_WORDS];
+static uint32_t pageErases[LOG_TEST_PAGES];
+static uint32_t doubleWrites = 0;
+
+// Samples logged, in order
+static uint32_t loggedTime[MAX_SAMPLES];
+static uint8_t  loggedColor[MAX_SAMPLES][3];
+static uint32_t logged = 0;
+
+// Position in the logged samples while reading back
+static uint32_t position;
+static uint32_t readBack;
+static bool inOrder;
+
+//
+// Fakes
+//
+
+static uint32_t flashWord(uint32_t address)
+{
+    return (address - LOG_START) / 4;
+}
+
+bool eraseFlashPage(uint32_t address)
+{
+    uint16_t i;
+
+    CHECK((address - LOG_START) % FLASH_PAGE_SIZE == 0);
+
+    for(i = 0; i < LOG_PAGE_WORDS; i++)
+    {
+        flash[flashWord(address) + i] = FLASH_ERASED;
+    }
+
+    pageErases[(address - LOG_START) / FLASH_PAGE_SIZE]++;
+
+    return true;
+}
+
+bool writeFlashWord(uint32_t address, uint32_t data)
+{
+    if(flash[flashWord(address)] != FLASH_ERASED)
+    {
+        doubleWrites++;
+    }
+
+    flash[flashWord(address)] &= data;
+
+    return true;
+}
+
+uint32_t readFlashWord(uint32_t address)
+{
+    return flash[flashWord(address)];
+}
+
+void sendUart0String(char str[]) {}
+void sendUart0Unsigned(uint32_t value) {}
+void sendUart0Fixed(int32_t value, uint8_t decimals) {}
+
+//
+// Helpers
+//
+
+// Samples read back must be logged samples, in the order they were logged
+static void visitSample(uint32_t time, uint8_t red, uint8_t green, uint8_t blue)
+{
+    while(position < logged
+          && !(loggedTime[position] == time && loggedColor[position][0] == red
+               && loggedColor[position][1] == green && loggedColor[position][2] == blue))
+    {
+        position++;
+    }
+
+    if(position == logged)
+    {
+        inOrder = false;
+    }
+    else
+    {
+        position++;
+    }
+
+    readBack++;
+}
+
+// Read the log back, returns true if it held samples in logged order ending
+// with the last one logged
+static bool readsBack(void)
+{
+    position = 0;
+    readBack = 0;
+    inOrder = true;
+
+    return readLog(visitSample) == readBack && inOrder && position == logged;
+}
+
+static uint32_t now = 0;
+static uint8_t color[3] = {128, 64, 200};
+
+// Log the next sample about 100 ms after the last, noisy or mostly steady
+static void logNext(bool noisy)
+{
+    uint8_t i;
+
+    now += 99 + (rand() % 3);
+
+    for(i = 0; i < 3; i++)
+    {
+        if(noisy)
+        {
+            color[i] += (rand() % 3) - 1;
+        }
+        else if(rand() % 50 == 0)
+        {
+            color[i] = rand();
+        }
+    }
+
+    CHECK(logSample(now, color[0], color[1], color[2]));
+
+    loggedTime[logged % MAX_SAMPLES] = now;
+    memcpy(loggedColor[logged % MAX_SAMPLES], color, 3);
+    logged++;
+}
+
+static void startLog(void)
+{
+    memset(flash, 0xFF, sizeof(flash));
+    memset(pageErases, 0, sizeof(pageErases));
+    logged = 0;
+    mountLog();
+    clearLog();
+    memset(&logStats, 0, sizeof(logStats));
+}
+
+//
+// Tests
+//
+
+static void testRoundTrip(void)
+{
+    uint32_t i;
+
+    startLog();
+
+    for(i = 0; i < 1000; i++)
+    {
+        logNext(i % 2);
+    }
+
+    flushLog();
+    CHECK(readsBack());
+    CHECK(readBack == logged);
+
+    // A remount starts a new page and keeps what was flushed
+    mountLog();
+    logNext(false);
+    flushLog();
+    CHECK(readsBack());
+    CHECK(readBack == logged);
+
+    clearLog();
+    CHECK(readLog(visitSample) == 0);
+}
+
+// A steady color at a steady period costs about a byte, the first sample of
+// each page and the odd jump aside
+static void testCompression(void)
+{
+    uint32_t i;
+
+    startLog();
+
+    for(i = 0; i < 5000; i++)
+    {
+        now += 100;
+        CHECK(logSample(now, 10, 20, 30));
+    }
+
+    CHECK(logStats.bytes < logStats.samples + (logStats.samples / 20));
+}
+
+// Wrap the ring many times: the newest samples read back, wear stays even
+static void testWrap(void)
+{
+    uint32_t i, most = 0, least = UINT32_MAX;
+
+    startLog();
+
+    for(i = 0; i < MAX_SAMPLES; i++)
+    {
+        logNext(i % 3 == 0);
+    }
+
+    flushLog();
+    CHECK(readsBack());
+    CHECK(readBack > (LOG_TEST_PAGES - 1) * FLASH_PAGE_SIZE / 4);
+
+    for(i = 0; i < LOG_TEST_PAGES; i++)
+    {
+        most = (pageErases[i] > most) ? pageErases[i] : most;
+        least = (pageErases[i] < least) ? pageErases[i] : least;
+    }
+
+    CHECK(most - least <= 1);
+    CHECK(doubleWrites == 0);
+}
+
+// A power cut loses the pending bytes: remounting without a flush must read
+// back only whole samples, in order
+static void testPowerCut(void)
+{
+    uint32_t i, count;
+    bool ok = true;
+
+    startLog();
+
+    for(i = 0; i < 3000; i++)
+    {
+        for(count = 1 + (rand() % 40); count > 0; count--)
+        {
+            logNext(rand() % 2);
+        }
+
+        mountLog();
+
+        position = 0;
+        readBack = 0;
+        inOrder = true;
+        readLog(visitSample);
+        ok = ok && inOrder;
+    }
+
+    CHECK(ok);
+    CHECK(doubleWrites == 0);
+}
+
+int main(void)
+{
+    srand(40);
+
+    testRoundTrip();
+    testCompression();
+    testWrap();
+    testPowerCut();
+
+    return testResult("logger");
+}
@@ -0,0 +1,346 @@
+// macrosTest.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// Macros over a simulated EEPROM: macros are stored, listed and erased, only
+// changed words are written, and a power cut at any write of a definition
+// leaves the old macro, the new one or one shown as corrupt, never a mix that
+// runs. Through the shell, a macro's commands run in turn with the rest of
+// the line, nesting stops at MAX_MACRO_DEPTH, and erased or corrupt macros
+// run nothing.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <setjmp.h>
+#include "test.h"
+#include "shell.h"
+#include "eeprom.h"
+#include "macros.h"
+#include "commands.h"
+#include "commandsFakes.h"
+
+#define EEPROM_WORDS (32 * EEPROM_BLOCK_WORDS)
+
+static uint32_t eeprom[EEPROM_WORDS];
+static uint32_t wordsWritten = 0;
+static int32_t writesLeft = -1;                 // writes before the power cut, -1 never
+static jmp_buf powerCut;
+static char output[1024];
+static uint16_t outputLength = 0;
+
+//
+// Fakes
+//
+
+uint32_t readEeprom(uint16_t add)
+{
+    return eeprom[add];
+}
+
+void readEepromWords(uint16_t add, uint32_t data[], uint16_t count)
+{
+    while(count--)
+    {
+        *data++ = readEeprom(add++);
+    }
+}
+
+void writeEeprom(uint16_t add, uint32_t data)
+{
+    if(writesLeft == 0)
+    {
+        longjmp(powerCut, 1);
+    }
+
+    if(writesLeft > 0)
+    {
+        writesLeft--;
+    }
+
+    eeprom[add] = data;
+    wordsWritten++;
+}
+
+void sendUart0String(char str[])
+{
+    outputLength += snprintf(&output[outputLength], sizeof(output) - outputLength, "%s", str);
+}
+
+void sendUart0StringLiteral(const char str[])
+{
+    sendUart0String((char*)str);
+}
+
+//
+// Helpers
+//
+
+static void clearOutput(void)
+{
+    outputLength = 0;
+    output[0] = 0;
+}
+
+static void startEeprom(void)
+{
+    memset(eeprom, 0xFF, sizeof(eeprom));
+}
+
+// Returns true if name loads with exactly body
+static bool loadsAs(const char name[], const char body[])
+{
+    char loaded[MACRO_BODY_LENGTH + 1];
+
+    return loadMacro(name, loaded) && strcmp(loaded, body) == 0;
+}
+
+// Run a line of commands as the shell task does
+static void run(const char line[])
+{
+    USER_DATA data;
+
+    resetUserInput(&data);
+    strcpy(data.buffer, line);
+    clearOutput();
+    executeCommands(&data);
+}
+
+// Returns true if the last run set the LEDs sets times, the last time to
+// value for each color
+static bool setRgb(uint32_t sets, uint16_t value)
+{
+    bool ok = fakeRgbSets == sets && (sets == 0 || (fakeRgb[0] == value && fakeRgb[1] == value && fakeRgb[2] == value));
+
+    fakeRgbSets = 0;
+
+    return ok;
+}
+
+//
+// Tests
+//
+
+static void testStore(void)
+{
+    char name[8];
+    uint8_t i;
+
+    startEeprom();
+
+    clearOutput();
+    printMacros();
+    CHECK(strcmp(output, "  NO macros stored.\r\n") == 0);
+
+    CHECK(storeMacro("red", "set 1023 0 0; print on"));
+    CHECK(loadsAs("red", "set 1023 0 0; print on"));
+    CHECK(!loadsAs("blue", ""));
+
+    clearOutput();
+    printMacros();
+    CHECK(strcmp(output, "  red = set 1023 0 0; print on\r\n") == 0);
+
+    // Names up to 8 characters and bodies up to MACRO_BODY_LENGTH
+    CHECK(storeMacro("abcdefgh", "0123456789012345678901234567890123456789012345678901"));
+    CHECK(loadsAs("abcdefgh", "0123456789012345678901234567890123456789012345678901"));
+    CHECK(!storeMacro("abcdefghi", "test"));
+    CHECK(!storeMacro("long", "01234567890123456789012345678901234567890123456789012"));
+
+    // Redefining reuses the slot, every slot in use refuses a new name
+    CHECK(storeMacro("red", "set 1 0 0") && loadsAs("red", "set 1 0 0"));
+
+    for(i = 2; i < MAX_MACROS; i++)
+    {
+        sprintf(name, "m%u", i);
+        CHECK(storeMacro(name, "test"));
+    }
+
+    CHECK(!storeMacro("extra", "test"));
+
+    // An erase frees the slot
+    CHECK(storeMacro("red", ""));
+    CHECK(!loadsAs("red", ""));
+    CHECK(storeMacro("extra", "test") && loadsAs("extra", "test"));
+    CHECK(storeMacro("none", ""));
+}
+
+// Only words that change are written, the check word among them
+static void testWrites(void)
+{
+    startEeprom();
+
+    wordsWritten = 0;
+    CHECK(storeMacro("go", "periodic 1"));
+    CHECK(wordsWritten == EEPROM_BLOCK_WORDS);
+
+    wordsWritten = 0;
+    CHECK(storeMacro("go", "periodic 1"));
+    CHECK(wordsWritten == 0);
+
+    // "periodic 1" to "periodic 2" changes one body word and the check word
+    wordsWritten = 0;
+    CHECK(storeMacro("go", "periodic 2"));
+    CHECK(wordsWritten == 2);
+}
+
+// A flipped bit shows the macro as corrupt, it runs nothing until defined again
+static void testCorrupt(void)
+{
+    char loaded[MACRO_BODY_LENGTH + 1];
+
+    startEeprom();
+    storeMacro("go", "periodic 1");
+    eeprom[(MACRO_BLOCK * EEPROM_BLOCK_WORDS) + 4] ^= 0x100;
+
+    clearOutput();
+    CHECK(loadMacro("go", loaded) && loaded[0] == '\0');
+    CHECK(strcmp(output, "  Macro corrupt, define it again.\r\n") == 0);
+
+    clearOutput();
+    printMacros();
+    CHECK(strcmp(output, "  go is corrupt, define it again\r\n") == 0);
+
+    CHECK(storeMacro("go", "periodic 1") && loadsAs("go", "periodic 1"));
+}
+
+// Cut the power at every write of a redefinition and of an erase
+static void testPowerCut(void)
+{
+    char loaded[MACRO_BODY_LENGTH + 1];
+    int32_t cut;
+    bool ok = true, finished = false;
+
+    for(cut = 0; !finished; cut++)
+    {
+        startEeprom();
+        storeMacro("go", "periodic 1; led on; print on");
+        writesLeft = cut;
+
+        if(!setjmp(powerCut))
+        {
+            storeMacro("go", "stable 5 3 2; trigger");
+            finished = true;
+        }
+
+        writesLeft = -1;
+
+        ok = ok && loadMacro("go", loaded);
+        ok = ok && (strcmp(loaded, "periodic 1; led on; print on") == 0
+                    || strcmp(loaded, "stable 5 3 2; trigger") == 0 || loaded[0] == '\0');
+    }
+
+    for(cut = 0, finished = false; !finished; cut++)
+    {
+        startEeprom();
+        storeMacro("go", "periodic 1");
+        writesLeft = cut;
+
+        if(!setjmp(powerCut))
+        {
+            storeMacro("go", "");
+            finished = true;
+        }
+
+        writesLeft = -1;
+
+        ok = ok && (!loadMacro("go", loaded) || strcmp(loaded, "periodic 1") == 0 || loaded[0] == '\0');
+
+        // A cut erase can be finished by erasing again
+        ok = ok && storeMacro("go", "") && !loadMacro("go", loaded);
+    }
+
+    CHECK(ok);
+}
+
+// A macro runs its commands in turn with the rest of the line
+static void testRun(void)
+{
+    startEeprom();
+    fakeRgbSets = 0;
+
+    run("macro red = set 1 1 1; set 2 2 2");
+    CHECK(strcmp(output, "  macro stored.\r\n") == 0 && setRgb(0, 0));
+
+    run("red");
+    CHECK(output[0] == '\0' && setRgb(2, 2));
+
+    run("red; set 5 5 5;red ; set 6 6 6");
+    CHECK(output[0] == '\0' && setRgb(6, 6));
+
+    // A bad command in a macro stops only itself
+    run("macro bad = set 1; set 3 3 3");
+    run("bad");
+    CHECK(strcmp(output, "  Usage: set R G B\r\n") == 0 && setRgb(1, 3));
+
+    // Commands keep their names
+    run("macro set = set 1 1 1");
+    CHECK(strcmp(output, "  Macro name is already a command.\r\n") == 0);
+}
+
+// Macros may run macros MAX_MACRO_DEPTH deep, deeper ones are skipped and
+// the commands around them still run
+static void testNesting(void)
+{
+    startEeprom();
+    fakeRgbSets = 0;
+
+    run("macro a = set 1 1 1");
+    run("macro b = a; set 2 2 2");
+    run("macro c = b; set 3 3 3");
+
+    run("b");
+    CHECK(output[0] == '\0' && setRgb(2, 2));
+
+    run("c");
+    CHECK(strcmp(output, "  Macros nested too deeply.\r\n") == 0 && setRgb(2, 3));
+
+    // A macro that runs itself ends at the same depth
+    run("macro loop = loop; set 4 4 4");
+    run("loop");
+    CHECK(strcmp(output, "  Macros nested too deeply.\r\n") == 0 && setRgb(2, 4));
+
+    // The depth is back to 0 afterwards
+    run("b");
+    CHECK(output[0] == '\0' && setRgb(2, 2));
+}
+
+// An erased macro is no longer a command, a corrupt one runs nothing
+static void testEraseRun(void)
+{
+    startEeprom();
+    fakeRgbSets = 0;
+
+    run("macro red = set 1 1 1");
+    run("macro red =");
+    CHECK(strcmp(output, "  macro erased.\r\n") == 0);
+
+    run("red");
+    CHECK(strcmp(output, "  Invalid command.\r\n") == 0 && setRgb(0, 0));
+
+    run("macro red = set 1 1 1");
+    eeprom[(MACRO_BLOCK * EEPROM_BLOCK_WORDS) + MACRO_NAME_WORDS] ^= 1;
+    run("red; set 7 7 7");
+    CHECK(strcmp(output, "  Macro corrupt, define it again.\r\n") == 0 && setRgb(1, 7));
+}
+
+int main(void)
+{
+    testStore();
+    testWrites();
+    testCorrupt();
+    testPowerCut();
+    testRun();
+    testNesting();
+    testEraseRun();
+
+    return testResult("macros");
+}
@@ -0,0 +1,277 @@
+// modelTest.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// Color class models against statistics computed in double. For random sets
+// of 2 to MAX_SAMPLES samples, the mean must round as the double mean does and
+// each packed sigma must be within a unit of the sample standard deviation.
+// Mahalanobis distances and confidences must follow the formulas, and samples
+// drawn from a normal class must average the 3 degrees of freedom of a
+// chi-square distance. The cost of a score is reported.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "test.h"
+#include "eeprom.h"
+#include "model.h"
+
+#define SAMPLE_SETS    20000
+#define RANDOM_SCORES  100000
+#define CLASS_SAMPLES  20000
+#define TIMING_ROUNDS  1000000
+#define PI             3.14159265358979323846
+
+//
+// Helpers
+//
+
+static double uniform(void)
+{
+    return (rand() + 1.0) / ((double)RAND_MAX + 2.0);
+}
+
+// Normal deviate by Box-Muller
+static double normal(void)
+{
+    return sqrt(-2 * log(uniform())) * cos(2 * PI * uniform());
+}
+
+static uint8_t clampSample(double value)
+{
+    return (value < 0) ? 0 : (value > 255) ? 255 : (uint8_t)lround(value);
+}
+
+// Squared Mahalanobis distance in units of 1/256, sigma in units of 1/2 plus
+// one count of noise
+static double mahalanobisReference(uint16_t model, uint32_t rgb, uint8_t red, uint8_t green, uint8_t blue)
+{
+    const double difference[3] = {(double)COLOR_RED(rgb) - red, (double)COLOR_GREEN(rgb) - green, (double)COLOR_BLUE(rgb) - blue};
+    double distance = 0, sigma;
+    uint8_t channel;
+
+    for(channel = 0; channel < 3; channel++)
+    {
+        sigma = MODEL_SIGMA(model, channel) / 2.0;
+        distance += difference[channel] * difference[channel] / ((sigma * sigma) + 1);
+    }
+
+    return 256 * distance;
+}
+
+// Chi-square survival function for 3 degrees of freedom
+static double chiSquareSurvival(double x)
+{
+    return erfc(sqrt(x / 2)) + (sqrt(2 * x / PI) * exp(-x / 2));
+}
+
+//
+// Tests
+//
+
+// Random classes of random size, a sigma past the packed range is clamped
+static void testEstimator(void)
+{
+    COLOR_STATS stats;
+    uint8_t sample[MAX_SAMPLES][3], mean[3], n, i, channel;
+    uint16_t model;
+    double sum, squares, expectedMean, deviation, expectedSigma, error, worst = 0;
+    uint32_t set;
+    bool ok = true;
+
+    for(set = 0; set < SAMPLE_SETS && ok; set++)
+    {
+        n = 1 + (rand() % MAX_SAMPLES);
+        resetColorStats(&stats);
+
+        for(i = 0; i < n; i++)
+        {
+            for(channel = 0; channel < 3; channel++)
+            {
+                deviation = (rand() % 4 == 0) ? 40 : (rand() % 8);
+                sample[i][channel] = clampSample(128 + (deviation * normal()));
+            }
+
+            addColorSample(&stats, sample[i][0], sample[i][1], sample[i][2]);
+        }
+
+        getColorMean(&stats, mean);
+        model = getColorModel(&stats);
+        ok = stats.count == n && (n >= 2) == ((model & MODEL_VALID) != 0);
+
+        for(channel = 0; ok && channel < 3; channel++)
+        {
+            sum = squares = 0;
+
+            for(i = 0; i < n; i++)
+            {
+                sum += sample[i][channel];
+            }
+
+            expectedMean = sum / n;
+
+            for(i = 0; i < n; i++)
+            {
+                squares += (sample[i][channel] - expectedMean) * (sample[i][channel] - expectedMean);
+            }
+
+            ok = mean[channel] == (uint8_t)floor(expectedMean + 0.5);
+
+            if(n >= 2)
+            {
+                // Sigma in units of 1/2
+                expectedSigma = fmin(2 * sqrt(squares / (n - 1)), MODEL_SIGMA_MAX);
+                error = fabs(MODEL_SIGMA(model, channel) - expectedSigma);
+                worst = fmax(worst, error);
+                ok = ok && error <= 1;
+            }
+        }
+
+        if(!ok)
+        {
+            printf("  set %u of %u samples\n", set, n);
+        }
+    }
+
+    CHECK(ok);
+
+    // Fewer than two samples make no model
+    resetColorStats(&stats);
+    CHECK(getColorModel(&stats) == 0);
+    getColorMean(&stats, mean);
+    CHECK(mean[0] == 0 && mean[1] == 0 && mean[2] == 0);
+
+    REPORT("estimator: worst sigma error %.3f counts\n", worst / 2);
+}
+
+// Scores follow the formula within the rounding of each channel, and
+// confidences follow the chi-square table they sample
+static void testScore(void)
+{
+    uint16_t model;
+    uint32_t rgb, n, distance;
+    uint8_t red, green, blue;
+    double expected, worst = 0, survival;
+    bool ok = true;
+
+    for(n = 0; n < RANDOM_SCORES && ok; n++)
+    {
+        model = MODEL_VALID | (rand() & 0x7FFF);
+        rgb = COLOR_RGB(rand() % 256, rand() % 256, rand() % 256);
+        red = rand() % 256;
+        green = rand() % 256;
+        blue = rand() % 256;
+
+        distance = mahalanobisSquared(model, rgb, red, green, blue);
+        expected = mahalanobisReference(model, rgb, red, green, blue);
+        worst = fmax(worst, fabs(distance - expected));
+        ok = distance <= expected && expected - distance < 3;
+
+        if(!ok)
+        {
+            printf("  model %04x: distance %u, expected %.2f\n", model, distance, expected);
+        }
+    }
+
+    CHECK(ok);
+
+    for(distance = 0, ok = true; distance < (80 << 6); distance++)
+    {
+        survival = 100 * chiSquareSurvival((distance >> 6) / 4.0);
+        ok = ok && fabs(modelConfidence(distance) - survival) <= 0.5 + 1e-9;
+    }
+
+    CHECK(ok);
+    CHECK(modelConfidence(0) == 100 && modelConfidence(UINT32_MAX) == 0);
+
+    REPORT("score: worst error %.3f / 256\n", worst);
+}
+
+// A class learned from normal samples scores new samples of the same class
+// at a mean distance of 3
+static void testClass(void)
+{
+    COLOR_STATS stats;
+    uint8_t mean[3], sample[3], channel, i;
+    const double sigma[3] = {3, 6, 10}, center[3] = {90, 140, 180};
+    uint16_t model;
+    uint32_t n, distance;
+    double sum = 0, rejected = 0, average;
+
+    resetColorStats(&stats);
+
+    for(i = 0; i < MAX_SAMPLES; i++)
+    {
+        for(channel = 0; channel < 3; channel++)
+        {
+            sample[channel] = clampSample(center[channel] + (sigma[channel] * normal()));
+        }
+
+        addColorSample(&stats, sample[0], sample[1], sample[2]);
+    }
+
+    getColorMean(&stats, mean);
+    model = getColorModel(&stats);
+
+    for(n = 0; n < CLASS_SAMPLES; n++)
+    {
+        for(channel = 0; channel < 3; channel++)
+        {
+            sample[channel] = clampSample(center[channel] + (sigma[channel] * normal()));
+        }
+
+        distance = mahalanobisSquared(model, COLOR_RGB(mean[0], mean[1], mean[2]), sample[0], sample[1], sample[2]);
+        sum += distance;
+        rejected += modelConfidence(distance) < MIN_CONFIDENCE;
+    }
+
+    average = sum / CLASS_SAMPLES / 256;
+
+    CHECK(average > 2 && average < 4.5);
+    CHECK(rejected / CLASS_SAMPLES < 0.02);
+
+    REPORT("class: mean distance %.2f, %.2f%% of samples below %u%% confidence\n",
+           average, 100 * rejected / CLASS_SAMPLES, MIN_CONFIDENCE);
+}
+
+// Report the cost of a score
+static void testTiming(void)
+{
+    uint32_t i, sum = 0;
+    clock_t start;
+    double score;
+
+    start = clock();
+    for(i = 0; i < TIMING_ROUNDS; i++)
+    {
+        sum += mahalanobisSquared(MODEL_VALID | (i & 0x7FFF), i, i >> 3, i >> 5, i >> 7);
+    }
+    score = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    CHECK(sum > 0);
+
+    REPORT("mahalanobisSquared %.1f ns per call\n", 1e9 * score / TIMING_ROUNDS);
+}
+
+int main(void)
+{
+    srand(34);
+
+    testEstimator();
+    testScore();
+    testClass();
+    testTiming();
+
+    return testResult("model");
+}
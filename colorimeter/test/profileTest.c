@@ -0,0 +1,167 @@
+// profileTest.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// Profiler on a simulated clock, built with PROFILE_CLOCK defined as
+// testClock by the Makefile. Every read of the clock costs PROBE_COST
+// cycles, which the probes must take off again. Reports name every probe and
+// print means too long for hundredths of a us in whole us.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include "test.h"
+#include "cycles.h"
+#include "profile.h"
+
+#define PROBE_COST   3                          // cycles of one clock read
+
+static uint32_t now = 0;                        // simulated cycle counter
+static char output[2048];
+static uint16_t outputLength = 0;
+
+//
+// Fakes
+//
+
+uint32_t testClock(void)
+{
+    uint32_t count = now;
+
+    now += PROBE_COST;
+
+    return count;
+}
+
+uint32_t cyclesToMicroseconds(uint32_t cycles) { return cycles / CYCLES_PER_MICROSECOND; }
+
+void sendUart0String(char str[])
+{
+    outputLength += snprintf(&output[outputLength], sizeof(output) - outputLength, "%s", str);
+}
+
+void sendUart0StringLiteral(const char str[])
+{
+    sendUart0String((char*)str);
+}
+
+void sendUart0Unsigned(uint32_t value)
+{
+    outputLength += snprintf(&output[outputLength], sizeof(output) - outputLength, "%u", value);
+}
+
+void sendUart0Fixed(int32_t value, uint8_t decimals)
+{
+    outputLength += snprintf(&output[outputLength], sizeof(output) - outputLength, "%d.%02d", value / 100, value % 100);
+}
+
+//
+// Helpers
+//
+
+// Code under a probe that takes cycles
+static void probed(uint8_t probe, uint32_t cycles)
+{
+    PROFILE_BEGIN(probe);
+    now += cycles;
+    PROFILE_END(probe);
+}
+
+static void print(void)
+{
+    outputLength = 0;
+    output[0] = 0;
+    printProfile();
+}
+
+//
+// Tests
+//
+
+static void testRecord(void)
+{
+    resetProfile();
+
+    print();
+    CHECK(strcmp(output, "  No probes hit.\r\n") == 0);
+
+    probed(PROBE_MATCH, 100);
+    probed(PROBE_MATCH, 300);
+    probed(PROBE_MATCH, 200);
+
+    CHECK(probeStats[PROBE_MATCH].count == 3 && probeStats[PROBE_MATCH].total == 600);
+    CHECK(probeStats[PROBE_MATCH].min == 100 && probeStats[PROBE_MATCH].max == 300);
+
+    // A measurement below the probe cost counts as 0
+    recordProbe(PROBE_DELTA, 1);
+    CHECK(probeStats[PROBE_DELTA].count == 1 && probeStats[PROBE_DELTA].max == 0);
+
+    print();
+    CHECK(strstr(output, "  match: 3 hits, min 100, mean 200, max 300 cycles, mean 2.50 us\r\n") != 0);
+    CHECK(strstr(output, "  delta: 1 hits") != 0);
+    CHECK(strstr(output, "measure") == 0);
+    CHECK(hostPrimask == 0);
+}
+
+// Every probe has its name
+static void testNames(void)
+{
+    static const char* const names[MAX_PROBES] =
+    {
+        "measure", "report", "match", "normalize", "delta", "channel", "uart isr"
+    };
+    char line[32];
+    uint8_t probe;
+    bool named = true;
+
+    resetProfile();
+
+    for(probe = 0; probe < MAX_PROBES; probe++)
+    {
+        probed(probe, 10);
+    }
+
+    print();
+
+    for(probe = 0; probe < MAX_PROBES; probe++)
+    {
+        sprintf(line, "  %s: 1 hits", names[probe]);
+        named = named && strstr(output, line) != 0;
+    }
+
+    CHECK(named);
+}
+
+// A mean too long for hundredths of a us in 32 bits prints in whole us
+static void testLongMean(void)
+{
+    resetProfile();
+
+    probed(PROBE_REPORT, 0xFFFFFFFF / 100);
+    print();
+    CHECK(strstr(output, "mean 536870.90 us") != 0);
+
+    resetProfile();
+
+    probed(PROBE_REPORT, 0xF0000000);
+    print();
+    CHECK(strstr(output, "mean 50331648 us") != 0);
+}
+
+int main(void)
+{
+    testRecord();
+    testNames();
+    testLongMean();
+
+    return testResult("profile");
+}
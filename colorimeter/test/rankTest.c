@@ -0,0 +1,328 @@
+// rankTest.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// Top-K selection against a full sort. Random candidates, many of them tied,
+// are offered to rankings of every size up to past MAX_RANK and to more than
+// the candidates there are. The sorted ranking must hold the K smallest
+// distances of the sorted candidates, each with its own index and confidence,
+// and the printed record must show them with the margin to the runner-up.
+// The cost of an offer is reported against sorting every candidate.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "test.h"
+#include "uart0.h"
+#include "timestamp.h"
+#include "rank.h"
+
+#define MAX_CANDIDATES 1024
+#define RANDOM_RANKINGS 20000
+#define TIMING_ROUNDS  2000
+
+static char output[256];
+static uint16_t outputLength = 0;
+
+static RANK_ENTRY candidate[MAX_CANDIDATES];
+static RANK_ENTRY sorted[MAX_CANDIDATES];
+
+//
+// Fakes
+//
+
+void sendUart0String(char str[])
+{
+    outputLength += snprintf(&output[outputLength], sizeof(output) - outputLength, "%s", str);
+}
+
+void sendUart0Stamp(uint64_t time, char separator) {}
+
+//
+// Helpers
+//
+
+static void clearOutput(void)
+{
+    outputLength = 0;
+    output[0] = 0;
+}
+
+static int compareEntries(const void* first, const void* second)
+{
+    const RANK_ENTRY* a = first;
+    const RANK_ENTRY* b = second;
+
+    return (a->distanceSquared > b->distanceSquared) - (a->distanceSquared < b->distanceSquared);
+}
+
+// Candidates with indexes 0..count-1, their distances drawn from a small
+// range for ties or a wide one, some with a class confidence
+static void randomCandidates(uint16_t count)
+{
+    uint32_t range = (rand() % 2) ? 8 : 1000000;
+    uint16_t i;
+
+    for(i = 0; i < count; i++)
+    {
+        candidate[i].index = i;
+        candidate[i].distanceSquared = rand() % range;
+        candidate[i].confidence = (rand() % 2) ? NO_CONFIDENCE : rand() % 101;
+    }
+
+    memcpy(sorted, candidate, count * sizeof(RANK_ENTRY));
+    qsort(sorted, count, sizeof(RANK_ENTRY), compareEntries);
+}
+
+static void rankCandidates(RANKING* ranking, uint8_t size, uint16_t count)
+{
+    uint16_t i;
+
+    resetRanking(ranking, size);
+
+    for(i = 0; i < count; i++)
+    {
+        offerRanking(ranking, candidate[i].index, candidate[i].distanceSquared, candidate[i].confidence);
+    }
+
+    sortRanking(ranking);
+}
+
+// Returns true if the ranking holds the closest candidates, closest first.
+// Tied candidates may be kept in any order.
+static bool rankingMatches(const RANKING* ranking, uint8_t size, uint16_t count)
+{
+    uint8_t expected = (size > MAX_RANK) ? MAX_RANK : size, i, j;
+    const RANK_ENTRY* entry;
+    bool ok;
+
+    expected = (count < expected) ? count : expected;
+    ok = ranking->count == expected;
+
+    for(i = 0; ok && i < ranking->count; i++)
+    {
+        entry = &ranking->entry[i];
+        ok = entry->distanceSquared == sorted[i].distanceSquared
+             && entry->index < count
+             && entry->distanceSquared == candidate[entry->index].distanceSquared
+             && entry->confidence == candidate[entry->index].confidence;
+
+        for(j = 0; ok && j < i; j++)
+        {
+            ok = ranking->entry[j].index != entry->index;
+        }
+    }
+
+    return ok;
+}
+
+// Distance in tenths, as the record shows it
+static uint32_t tenths(uint32_t distanceSquared, uint8_t shift)
+{
+    return (uint32_t)floor((sqrt(distanceSquared) * 10 / (1 << shift)) + 0.5);
+}
+
+// The text record printRanking() should send for a sorted ranking
+static void expectedRecord(const RANKING* ranking, uint8_t shift, char record[])
+{
+    uint8_t shown = (ranking->count < rankSize) ? ranking->count : rankSize, i;
+    uint32_t distance, margin;
+    char* end = record;
+
+    end += sprintf(end, "  match");
+
+    for(i = 0; i < shown; i++)
+    {
+        distance = tenths(ranking->entry[i].distanceSquared, shift);
+        end += sprintf(end, "%s%u %u.%u", (i == 0) ? " " : ", ", ranking->entry[i].index, distance / 10, distance % 10);
+
+        if(ranking->entry[i].confidence != NO_CONFIDENCE)
+        {
+            end += sprintf(end, " (%u%%)", ranking->entry[i].confidence);
+        }
+    }
+
+    if(ranking->count > 1)
+    {
+        margin = tenths(ranking->entry[1].distanceSquared, shift) - tenths(ranking->entry[0].distanceSquared, shift);
+        end += sprintf(end, ", margin %u.%u", margin / 10, margin % 10);
+    }
+
+    sprintf(end, "\r\n");
+}
+
+//
+// Tests
+//
+
+// Random candidates and sizes, K from 0 to past MAX_RANK and N from 0 up
+static void testRandom(void)
+{
+    RANKING ranking;
+    char record[256];
+    uint16_t count;
+    uint8_t size, shift;
+    uint32_t n, larger = 0;
+    bool ok = true;
+
+    for(n = 0; n < RANDOM_RANKINGS && ok; n++)
+    {
+        count = (rand() % 4) ? rand() % 16 : rand() % MAX_CANDIDATES;
+        size = rand() % (MAX_RANK + 3);
+        larger += size > count;
+
+        randomCandidates(count);
+        rankCandidates(&ranking, size, count);
+        ok = rankingMatches(&ranking, size, count);
+
+        // The record shows one entry fewer than the ranking keeps
+        rankSize = (size > 1) ? size - 1 : size;
+        shift = (rand() % 2) ? 4 : 0;
+        rankFormat = RANK_TEXT;
+        clearOutput();
+        printRanking(&ranking, shift, 0);
+
+        if(ranking.count == 0)
+        {
+            ok = ok && outputLength == 0;
+        }
+        else
+        {
+            expectedRecord(&ranking, shift, record);
+            ok = ok && strcmp(output, record) == 0;
+        }
+
+        if(!ok)
+        {
+            printf("  size %u of %u candidates: \"%s\"\n", size, count, output);
+        }
+    }
+
+    CHECK(ok);
+    CHECK(larger > RANDOM_RANKINGS / 8);
+}
+
+// Every candidate tied, and one candidate closer than the rest
+static void testTies(void)
+{
+    RANKING ranking;
+    uint16_t i;
+
+    resetRanking(&ranking, 4);
+    for(i = 0; i < 100; i++)
+    {
+        offerRanking(&ranking, i, 400, NO_CONFIDENCE);
+    }
+    sortRanking(&ranking);
+
+    CHECK(ranking.count == 4);
+    CHECK(ranking.entry[0].distanceSquared == 400 && ranking.entry[3].distanceSquared == 400);
+
+    rankSize = 3;
+    rankFormat = RANK_TEXT;
+    clearOutput();
+    printRanking(&ranking, 0, 0);
+    CHECK(strstr(output, ", margin 0.0\r\n") != 0);
+
+    resetRanking(&ranking, 2);
+    for(i = 0; i < 100; i++)
+    {
+        offerRanking(&ranking, i, (i == 57) ? 100 : 400, (i == 57) ? 86 : NO_CONFIDENCE);
+    }
+    sortRanking(&ranking);
+
+    rankSize = 1;
+    clearOutput();
+    printRanking(&ranking, 0, 0);
+    CHECK(strcmp(output, "  match 57 10.0 (86%), margin 10.0\r\n") == 0);
+
+    rankFormat = RANK_CSV;
+    clearOutput();
+    printRanking(&ranking, 0, 0);
+    CHECK(strcmp(output, "  match,1,10.0,57,10.0,86\r\n") == 0);
+}
+
+// More room than candidates, and a single candidate has no margin
+static void testShort(void)
+{
+    RANKING ranking;
+
+    resetRanking(&ranking, MAX_RANK + 5);
+    CHECK(ranking.size == MAX_RANK);
+
+    offerRanking(&ranking, 9, 2500, NO_CONFIDENCE);
+    sortRanking(&ranking);
+    CHECK(ranking.count == 1 && ranking.entry[0].index == 9);
+
+    rankSize = 3;
+    rankFormat = RANK_TEXT;
+    clearOutput();
+    printRanking(&ranking, 0, 0);
+    CHECK(strcmp(output, "  match 9 50.0\r\n") == 0);
+
+    rankFormat = RANK_CSV;
+    clearOutput();
+    printRanking(&ranking, 0, 0);
+    CHECK(strcmp(output, "  match,1,,9,50.0,\r\n") == 0);
+
+    resetRanking(&ranking, 0);
+    offerRanking(&ranking, 1, 0, NO_CONFIDENCE);
+    CHECK(ranking.count == 0);
+}
+
+// Report the cost of ranking a full library both ways
+static void testTiming(void)
+{
+    RANKING ranking;
+    uint32_t n, sum = 0;
+    clock_t start;
+    double heap, sort;
+
+    randomCandidates(MAX_CANDIDATES);
+
+    start = clock();
+    for(n = 0; n < TIMING_ROUNDS; n++)
+    {
+        rankCandidates(&ranking, 4, MAX_CANDIDATES);
+        sum += ranking.entry[0].distanceSquared;
+    }
+    heap = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    for(n = 0; n < TIMING_ROUNDS; n++)
+    {
+        memcpy(sorted, candidate, sizeof(sorted));
+        qsort(sorted, MAX_CANDIDATES, sizeof(RANK_ENTRY), compareEntries);
+        sum -= sorted[0].distanceSquared;
+    }
+    sort = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    CHECK(sum == 0);
+
+    REPORT("%u candidates: top 4 heap %.1f us, full sort %.1f us\n", MAX_CANDIDATES,
+           1e6 * heap / TIMING_ROUNDS, 1e6 * sort / TIMING_ROUNDS);
+}
+
+int main(void)
+{
+    srand(35);
+
+    testRandom();
+    testTies();
+    testShort();
+    testTiming();
+
+    return testResult("rank");
+}
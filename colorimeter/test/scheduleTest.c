@@ -0,0 +1,166 @@
+// scheduleTest.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    80 MHz
+
+// Overrun policies against a simulated us timestamp. A sample takes three settle
+// times plus a fixed overhead from its deadline; a deadline passed while a
+// sample runs is dropped, as the Timer1 ISR does.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "test.h"
+#include "led.h"
+#include "schedule.h"
+
+//
+// Fakes
+//
+
+uint32_t settleTime = SETTLE_TIME;
+
+void sendUart0String(char str[]) {}
+void sendUart0StringLiteral(const char str[]) {}
+void sendUart0Unsigned(uint32_t value) {}
+void sendUart0Fixed(int32_t value, uint8_t decimals) {}
+
+//
+// Helpers
+//
+
+static uint64_t deadline = 0;                    // us timestamp
+
+// Run samples that start latency us after their deadline and take three
+// settle times plus overhead us. Returns the last result.
+static uint8_t runSamples(uint32_t count, uint32_t latency, uint32_t overhead)
+{
+    uint64_t end, late;
+    uint8_t result = SCHEDULE_ON_TIME;
+
+    while(count--)
+    {
+        end = deadline + latency + (3 * schedule.settle) + overhead;
+        result = checkSchedule(&schedule, deadline, end, settleTime);
+
+        if(result == SCHEDULE_STRETCHED)
+        {
+            // The timer restarts with the new period when the sample ends
+            deadline = end + schedule.period;
+        }
+        else
+        {
+            late = (end - deadline) / schedule.period;
+            deadline += schedule.period * (late + 1);
+        }
+    }
+
+    return result;
+}
+
+static void startSchedule(uint8_t policy, uint32_t period)
+{
+    resetSchedule(&schedule, period);
+    schedule.policy = policy;
+}
+
+//
+// Tests
+//
+
+// 62 ms samples at 50 ms, 20 ms settle and 2 ms overhead
+static void testPolicies(void)
+{
+    settleTime = 20000;
+
+    // Skip keeps the period and drops every other deadline
+    startSchedule(OVERRUN_SKIP, 50000);
+    CHECK(runSamples(100, 0, 2000) == SCHEDULE_SKIPPED);
+    CHECK(schedule.overruns == 100 && schedule.skipped == 100);
+    CHECK(schedule.elapsed == 99 * 100000);
+    CHECK(schedule.settle == settleTime);
+
+    // Stretch settles at the sample time plus 1/8
+    startSchedule(OVERRUN_STRETCH, 50000);
+    runSamples(100, 0, 2000);
+    CHECK(schedule.period == 62000 + (62000 >> SCHEDULE_SLACK));
+    CHECK(schedule.overruns == 1);
+
+    // Degrade cuts the settle time until a sample fits with 1/8 to spare,
+    // and never touches the configured settle time
+    startSchedule(OVERRUN_DEGRADE, 50000);
+    runSamples(100, 0, 2000);
+    CHECK(schedule.overruns == 1 && schedule.adapted == 1);
+    CHECK(schedule.settle < settleTime && settleTime == 20000);
+    CHECK((3 * schedule.settle) + 2000 <= 50000 - (50000 >> SCHEDULE_SLACK));
+    CHECK(runSamples(1000, 0, 2000) == SCHEDULE_ON_TIME && schedule.overruns == 1);
+}
+
+// Once the overhead that forced a cut goes away, the settle time grows back
+// to the configured one, which fits the period, without another overrun
+static void testDegradeRecovers(void)
+{
+    settleTime = 20000;
+    startSchedule(OVERRUN_DEGRADE, 80000);
+
+    runSamples(10, 0, 20000);
+    CHECK(schedule.overruns == 1 && schedule.settle < settleTime);
+
+    runSamples(200, 0, 1000);
+    CHECK(schedule.settle == settleTime);
+    CHECK(schedule.overruns == 1);
+
+    // A lower configured settle time takes effect at once
+    settleTime = 5000;
+    runSamples(1, 0, 1000);
+    CHECK(schedule.settle == 5000);
+
+    // Leaving degrade puts the configured settle time back
+    settleTime = 20000;
+    runSamples(10, 0, 20000);
+    schedule.policy = OVERRUN_SKIP;
+    runSamples(1, 0, 1000);
+    CHECK(schedule.settle == settleTime);
+}
+
+// A sample that starts late misses the next deadline even when it runs for
+// less than a period, lateness counts from the deadline
+static void testLateStart(void)
+{
+    settleTime = 2000;
+    startSchedule(OVERRUN_SKIP, 20000);
+
+    CHECK(runSamples(1, 0, 4000) == SCHEDULE_ON_TIME);
+    CHECK(runSamples(1, 12000, 4000) == SCHEDULE_SKIPPED);
+    CHECK(schedule.overruns == 1 && schedule.longest == 12000 + 6000 + 4000);
+}
+
+// Periods longer than the cycle counter wraps, 53 s at 80 MHz, are timed
+// the same way, and so is a late start across such a period
+static void testLongPeriod(void)
+{
+    settleTime = 2000;
+    startSchedule(OVERRUN_SKIP, 600000000);
+
+    CHECK(runSamples(10, 0, 4000) == SCHEDULE_ON_TIME);
+    CHECK(schedule.elapsed == 9 * 600000000ull);
+
+    CHECK(runSamples(1, 599995000, 4000) == SCHEDULE_SKIPPED);
+    CHECK(schedule.longest == 599995000 + 6000 + 4000);
+}
+
+int main(void)
+{
+    testPolicies();
+    testDegradeRecovers();
+    testLateStart();
+    testLongPeriod();
+
+    return testResult("schedule");
+}
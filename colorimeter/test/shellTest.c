@@ -0,0 +1,356 @@
+// shellTest.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// Tokenizer over a generated corpus. Lines of signed decimal, hex and
+// fraction tokens, numbers too large for 32 bits, malformed numbers and
+// words are split at delimiters and ';', and everything after an '=' is one
+// raw field. Every field must come back with the view, type and value the
+// generator expected.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test.h"
+#include "shell.h"
+
+#define LINES        20000
+#define MAX_COMMANDS 4
+
+static uint32_t dataRegister;
+
+// What the generator put in one command of a line
+typedef struct _EXPECTED
+{
+    uint8_t fieldCount;
+    char    view[MAX_FIELDS][MAX_CHARS + 1];
+    char    type[MAX_FIELDS];
+    int32_t value[MAX_FIELDS];
+} EXPECTED;
+
+static EXPECTED expected[MAX_COMMANDS];
+
+//
+// Fakes
+//
+
+volatile uint32_t* hostUart0Data(void) { return &dataRegister; }
+void sendUart0String(char str[]) {}
+
+//
+// Helpers
+//
+
+static uint64_t random64(void)
+{
+    return ((uint64_t)rand() << 33) ^ ((uint64_t)rand() << 11) ^ rand();
+}
+
+// A magnitude near one of the limits the parser checks, or anywhere below 2^34
+static uint64_t randomMagnitude(void)
+{
+    static const uint64_t limits[] = {0, 9, INT32_MAX / 1000, INT32_MAX >> 4, INT32_MAX, (uint64_t)INT32_MAX + 1};
+    uint64_t limit = limits[rand() % 6], offset = rand() % 5;
+
+    if(rand() % 3 == 0)
+    {
+        return (limit >= 2) ? limit + offset - 2 : limit + offset;
+    }
+
+    return random64() >> (30 + (rand() % 30));
+}
+
+static const char* randomSign(bool* negative)
+{
+    switch(rand() % 3)
+    {
+        case 0:
+            *negative = true;
+            return "-";
+        case 1:
+            *negative = false;
+            return "+";
+        default:
+            *negative = false;
+            return "";
+    }
+}
+
+static void expectNumber(char* type, int32_t* value, char numeric, uint64_t magnitude, bool negative)
+{
+    if(magnitude > INT32_MAX)
+    {
+        *type = 'A';
+        *value = 0;
+    }
+    else
+    {
+        *type = numeric;
+        *value = negative ? -(int32_t)magnitude : (int32_t)magnitude;
+    }
+}
+
+// Write a random token and the type and value it should parse to
+static void randomToken(char token[], char* type, int32_t* value)
+{
+    static const char* words[] = {"set", "off", "hz", "x", "_a_b", "0x", "-", "+", ".", "1.2.3", "12a", "0x1g", "-0x", "+.", "0x1.5", "a-1"};
+    static const uint64_t place[] = {100, 10, 1};
+    uint64_t magnitude, whole;
+    uint8_t decimals, digit, i;
+    const char* sign;
+    bool negative;
+
+    switch(rand() % 4)
+    {
+        // Decimal integer, possibly with leading zeros
+        case 0:
+            magnitude = randomMagnitude() % 100000000000ull;
+            sign = randomSign(&negative);
+            sprintf(token, "%s%s%llu", sign, (rand() % 8) ? "" : "00", (unsigned long long)magnitude);
+            expectNumber(type, value, 'N', magnitude, negative);
+            break;
+
+        // Hex integer
+        case 1:
+            magnitude = randomMagnitude() & 0xFFFFFFFFFull;
+            sign = randomSign(&negative);
+            sprintf(token, "%s0x%llx", sign, (unsigned long long)magnitude);
+            expectNumber(type, value, 'N', magnitude, negative);
+            break;
+
+        // Fraction with 0 to 5 decimals, those past the third are dropped
+        case 2:
+            whole = randomMagnitude();
+            whole = (whole > 99999999ull) ? whole % 3000000 : whole;
+            decimals = rand() % 6;
+            sign = randomSign(&negative);
+            sprintf(token, "%s%llu.", sign, (unsigned long long)whole);
+
+            magnitude = whole * 1000;
+            for(i = 0; i < decimals; i++)
+            {
+                digit = rand() % 10;
+                sprintf(&token[strlen(token)], "%u", digit);
+                magnitude += (i < 3) ? digit * place[i] : 0;
+            }
+
+            expectNumber(type, value, 'F', (whole > INT32_MAX / 1000) ? (uint64_t)INT32_MAX + 1 : magnitude, negative);
+            break;
+
+        // Words and malformed numbers
+        default:
+            strcpy(token, words[rand() % 16]);
+            *type = 'A';
+            *value = 0;
+            break;
+    }
+}
+
+static const char* randomDelimiter(void)
+{
+    static const char* delimiters[] = {" ", "  ", ",", ", ", "\t", "("};
+
+    return delimiters[rand() % 6];
+}
+
+// Build a line of up to MAX_COMMANDS commands, the last may end in a raw
+// field. Returns the number of commands.
+static uint8_t randomLine(char line[])
+{
+    char token[MAX_CHARS + 1], raw[MAX_CHARS + 1];
+    uint8_t commands = 1 + (rand() % MAX_COMMANDS), command, fields, i;
+    char type;
+    int32_t value;
+    EXPECTED* e;
+
+    line[0] = '\0';
+
+    for(command = 0; command < commands; command++)
+    {
+        e = &expected[command];
+        e->fieldCount = 0;
+        fields = rand() % (MAX_FIELDS + 2);
+
+        if(command > 0)
+        {
+            strcat(line, (rand() % 2) ? ";" : " ; ");
+        }
+
+        for(i = 0; i < fields; i++)
+        {
+            randomToken(token, &type, &value);
+
+            if(strlen(line) + strlen(token) + 4 > MAX_CHARS - 20)
+            {
+                break;
+            }
+
+            strcat(line, randomDelimiter());
+            strcat(line, token);
+
+            // Fields past MAX_FIELDS are dropped
+            if(e->fieldCount < MAX_FIELDS)
+            {
+                strcpy(e->view[e->fieldCount], token);
+                e->type[e->fieldCount] = type;
+                e->value[e->fieldCount++] = value;
+            }
+        }
+
+        // A raw field keeps everything after the '=', ';' too
+        if(command == commands - 1 && rand() % 3 == 0)
+        {
+            strcpy(raw, (rand() % 2) ? "set 1 0x2 3.5; print on" : "");
+            strcat(line, (rand() % 2) ? " = " : "=");
+            strcat(line, raw);
+
+            if(e->fieldCount < MAX_FIELDS)
+            {
+                strcpy(e->view[e->fieldCount], raw);
+                e->type[e->fieldCount] = 'R';
+                e->value[e->fieldCount++] = 0;
+            }
+        }
+    }
+
+    return commands;
+}
+
+// Returns true if the parsed command holds exactly the expected fields
+static bool fieldsMatch(USER_DATA* data, const EXPECTED* e)
+{
+    uint8_t i;
+    bool ok = data->fieldCount == e->fieldCount;
+
+    for(i = 0; ok && i < e->fieldCount; i++)
+    {
+        ok = strcmp(getFieldView(data, i), e->view[i]) == 0
+             && data->field[i].length == strlen(e->view[i])
+             && data->field[i].type == e->type[i]
+             && data->field[i].value == e->value[i];
+
+        if(!ok)
+        {
+            printf("  field %u \"%s\": type %c value %d, expected \"%s\" %c %d\n", i, getFieldView(data, i),
+                   data->field[i].type, data->field[i].value, e->view[i], e->type[i], e->value[i]);
+        }
+    }
+
+    return ok;
+}
+
+static void parseLine(USER_DATA* data, const char line[])
+{
+    resetUserInput(data);
+    strcpy(data->buffer, line);
+}
+
+//
+// Tests
+//
+
+// Boundaries of each number form
+static void testValues(void)
+{
+    USER_DATA data;
+
+    parseLine(&data, "2147483647 -2147483647 2147483648 0x7fffffff 0x80000000");
+    CHECK(parseFields(&data) && data.fieldCount == 5);
+    CHECK(data.field[0].type == 'N' && data.field[0].value == INT32_MAX);
+    CHECK(data.field[1].type == 'N' && data.field[1].value == -INT32_MAX);
+    CHECK(data.field[2].type == 'A' && data.field[2].value == 0);
+    CHECK(data.field[3].type == 'N' && data.field[3].value == INT32_MAX);
+    CHECK(data.field[4].type == 'A');
+
+    parseLine(&data, "2147483.647 2147483.648 2147484.0 -0.0005 .5");
+    CHECK(parseFields(&data) && data.fieldCount == 5);
+    CHECK(data.field[0].type == 'F' && data.field[0].value == INT32_MAX);
+    CHECK(data.field[1].type == 'A' && data.field[2].type == 'A');
+    CHECK(data.field[3].type == 'F' && data.field[3].value == 0);
+    CHECK(data.field[4].type == 'F' && data.field[4].value == 500);
+
+    // Typed views of a fraction and an integer
+    parseLine(&data, "set -2.75 40000000");
+    CHECK(parseFields(&data));
+    CHECK(getFieldInteger(&data, 1) == -2 && getFieldFixed(&data, 1) == -2750);
+    CHECK(getFieldScaled(&data, 1, 1000) == 0);
+    CHECK(getFieldFixed(&data, 2) == INT32_MAX && getFieldScaled(&data, 2, 1000) == 0xFFFFFFFF);
+    CHECK(strcmp(getFieldView(&data, 3), "") == 0 && getFieldInteger(&data, 3) == 0);
+}
+
+// Commands split at ';', the raw field keeps the rest of the line
+static void testSplitting(void)
+{
+    USER_DATA data;
+
+    parseLine(&data, "set 1 2 3;print on ; macro go = set 4 5 6; print off");
+
+    CHECK(parseFields(&data) && data.fieldCount == 4 && strcmp(getFieldView(&data, 3), "3") == 0);
+    CHECK(parseFields(&data) && data.fieldCount == 2 && strcmp(getFieldView(&data, 1), "on") == 0);
+    CHECK(parseFields(&data) && data.fieldCount == 3 && data.field[2].type == 'R');
+    CHECK(strcmp(getFieldView(&data, 2), "set 4 5 6; print off") == 0);
+    CHECK(!parseFields(&data) && data.fieldCount == 0);
+
+    // Empty commands have no fields
+    parseLine(&data, ";;x");
+    CHECK(parseFields(&data) && data.fieldCount == 0);
+    CHECK(parseFields(&data) && data.fieldCount == 0);
+    CHECK(parseFields(&data) && data.fieldCount == 1);
+    CHECK(!parseFields(&data));
+}
+
+static void testCorpus(void)
+{
+    USER_DATA data;
+    char line[MAX_CHARS + 1];
+    uint32_t n, fields = 0, raw = 0;
+    uint8_t commands, command;
+    bool ok = true, parsed;
+
+    for(n = 0; n < LINES && ok; n++)
+    {
+        commands = randomLine(line);
+        parseLine(&data, line);
+
+        for(command = 0; command < commands && ok; command++)
+        {
+            // A line that ends in an empty command may end without it
+            parsed = parseFields(&data);
+            ok = parsed ? fieldsMatch(&data, &expected[command])
+                        : command == commands - 1 && expected[command].fieldCount == 0;
+            fields += data.fieldCount;
+            raw += data.fieldCount > 0 && data.field[data.fieldCount - 1].type == 'R';
+        }
+
+        ok = ok && !parseFields(&data);
+
+        if(!ok)
+        {
+            printf("  line \"%s\"\n", line);
+        }
+    }
+
+    CHECK(ok);
+    CHECK(fields > LINES && raw > LINES / 20);
+}
+
+int main(void)
+{
+    srand(27);
+
+    testValues();
+    testSplitting();
+    testCorpus();
+
+    return testResult("shell");
+}
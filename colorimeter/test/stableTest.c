@@ -0,0 +1,237 @@
+// stableTest.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// Match stabilizer replaying flicker sequences. Recorded sequences of best
+// match labels run through the majority and dwell modes, and a change must
+// be reported exactly where the window allows it and never for the state
+// already held. Random flicker between neighbors is replayed against a
+// stabilizer that recounts the whole window each sample. The output saved
+// and the cost of a sample are reported.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "test.h"
+#include "stable.h"
+
+#define RANDOM_SEQUENCES 2000
+#define SEQUENCE_LENGTH  500
+#define TIMING_SAMPLES   10000000
+
+static STABILIZER stabilizer;
+
+//
+// Helpers
+//
+
+// Label of a sequence letter, '-' for a sample that matched nothing
+static uint16_t letterLabel(char letter)
+{
+    return (letter == '-') ? STABLE_NONE : letter - 'A';
+}
+
+// Replay a sequence of labels as letters. Returns the changes reported, the
+// new state at each change and '.' elsewhere.
+static const char* replay(const char sequence[], uint8_t window, uint8_t majority, uint8_t dwell)
+{
+    static char changes[64];
+    uint8_t i;
+
+    configureStabilizer(&stabilizer, window, majority, dwell);
+
+    for(i = 0; sequence[i] != 0; i++)
+    {
+        changes[i] = '.';
+
+        if(updateStabilizer(&stabilizer, letterLabel(sequence[i])))
+        {
+            changes[i] = (stabilizer.state == STABLE_NONE) ? '-' : 'A' + stabilizer.state;
+        }
+    }
+
+    changes[i] = 0;
+
+    return changes;
+}
+
+// The state a stabilizer that recounts the window each sample would report
+// after sample n of labels, or 0xFFFF for no change
+static uint16_t recount(const uint16_t labels[], uint16_t n, uint16_t state, uint8_t window, uint8_t majority, uint8_t dwell)
+{
+    uint16_t first = (n + 1 > window) ? n + 1 - window : 0, votes = 0, run = 0, i;
+
+    for(i = first; i <= n; i++)
+    {
+        votes += labels[i] == labels[n];
+    }
+
+    for(i = n + 1; i > 0 && labels[i - 1] == labels[n]; i--)
+    {
+        run++;
+    }
+
+    return (labels[n] != state && votes >= majority && run >= dwell) ? labels[n] : 0xFFFF;
+}
+
+// A target moving across neighboring references, flickering to the next one
+// near each border and now and then matching nothing
+static void randomSequence(uint16_t labels[], uint16_t length)
+{
+    uint16_t position = rand() % 1000, i, reference;
+    uint8_t flicker = rand() % 40;
+
+    for(i = 0; i < length; i++)
+    {
+        position += (rand() % 3 == 0);
+        reference = (position / 20) % TOTAL_COLORS;
+
+        if(rand() % 100 < flicker)
+        {
+            reference = (reference + 1) % TOTAL_COLORS;
+        }
+
+        labels[i] = (rand() % 50 == 0) ? STABLE_NONE : reference;
+    }
+}
+
+//
+// Tests
+//
+
+// Recorded flicker through the majority mode
+static void testMajority(void)
+{
+    // Alternating neighbors never hold 4 of 5
+    CHECK(strcmp(replay("ABABABABABABAB", 5, 4, 1), "..............") == 0);
+
+    // A settles once it holds 3 of 5, one stray B does not move it
+    CHECK(strcmp(replay("ABAABAAAABBBAA", 5, 3, 1), "...A.......B..") == 0);
+
+    // Two stable states in a row, then a dropout to no match
+    CHECK(strcmp(replay("AAACCC---", 3, 2, 1), ".A..C..-.") == 0);
+}
+
+// Recorded flicker through the dwell mode
+static void testDwell(void)
+{
+    // A needs three in a row, each break starts the count again
+    CHECK(strcmp(replay("AABAABAAAB", 1, 1, 3), "........A.") == 0);
+
+    // B takes over only after its own run, staying on A reports nothing
+    CHECK(strcmp(replay("AAAAABBABBBAAAA", 1, 1, 3), "..A.......B..A.") == 0);
+
+    // Both: a run of 2 within a majority of 4 of 6
+    CHECK(strcmp(replay("ABAABAAB", 6, 4, 2), "......A.") == 0);
+}
+
+// Limits and labels past the library
+static void testLimits(void)
+{
+    uint16_t i, changes;
+
+    configureStabilizer(&stabilizer, 0, 0, 0);
+    CHECK(stabilizer.window == 1 && stabilizer.majority == 1 && stabilizer.dwell == 1);
+
+    configureStabilizer(&stabilizer, MAX_WINDOW + 10, MAX_WINDOW + 20, 200);
+    CHECK(stabilizer.window == MAX_WINDOW && stabilizer.majority == MAX_WINDOW && stabilizer.dwell == 200);
+    CHECK(stabilizer.state == STABLE_UNSET);
+
+    configureStabilizer(&stabilizer, 1, 1, 1);
+    CHECK(updateStabilizer(&stabilizer, 0xFFFE) && stabilizer.state == STABLE_NONE);
+    CHECK(!updateStabilizer(&stabilizer, STABLE_NONE + 1));
+
+    // The longest dwell, where the run count saturates
+    configureStabilizer(&stabilizer, 1, 1, 255);
+    for(i = 1, changes = 0; i < 255; i++)
+    {
+        changes += updateStabilizer(&stabilizer, 3);
+    }
+    CHECK(changes == 0 && updateStabilizer(&stabilizer, 3) && !updateStabilizer(&stabilizer, 3));
+}
+
+// Random flicker against a recount of the window, and the output it saves
+static void testReplay(void)
+{
+    uint16_t labels[SEQUENCE_LENGTH], n, state, expected;
+    uint8_t window, majority, dwell;
+    uint32_t sequence, samples = 0, changes = 0, rawChanges = 0;
+    bool ok = true, changed;
+
+    for(sequence = 0; sequence < RANDOM_SEQUENCES && ok; sequence++)
+    {
+        window = 1 + (rand() % MAX_WINDOW);
+        majority = 1 + (rand() % window);
+        dwell = 1 + (rand() % 6);
+        randomSequence(labels, SEQUENCE_LENGTH);
+        configureStabilizer(&stabilizer, window, majority, dwell);
+        state = STABLE_UNSET;
+
+        for(n = 0; n < SEQUENCE_LENGTH && ok; n++)
+        {
+            changed = updateStabilizer(&stabilizer, labels[n]);
+            expected = recount(labels, n, state, window, majority, dwell);
+            ok = changed == (expected != 0xFFFF) && (!changed || stabilizer.state == expected);
+            state = changed ? expected : state;
+
+            samples++;
+            changes += changed;
+            rawChanges += n > 0 && labels[n] != labels[n - 1];
+
+            if(!ok)
+            {
+                printf("  window %u, majority %u, dwell %u: sample %u\n", window, majority, dwell, n);
+            }
+        }
+    }
+
+    CHECK(ok);
+    CHECK(changes < rawChanges / 4);
+
+    REPORT("%u samples: %u raw label changes, %u stable changes reported\n", samples, rawChanges, changes);
+}
+
+// Report the cost of a sample with the largest window
+static void testTiming(void)
+{
+    uint32_t i, changes = 0;
+    clock_t start;
+    double update;
+
+    configureStabilizer(&stabilizer, MAX_WINDOW, MAX_WINDOW / 2, 2);
+
+    start = clock();
+    for(i = 0; i < TIMING_SAMPLES; i++)
+    {
+        changes += updateStabilizer(&stabilizer, (i >> 4) % TOTAL_COLORS);
+    }
+    update = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    CHECK(changes > 0);
+
+    REPORT("updateStabilizer %.1f ns per sample\n", 1e9 * update / TIMING_SAMPLES);
+}
+
+int main(void)
+{
+    srand(36);
+
+    testMajority();
+    testDwell();
+    testLimits();
+    testReplay();
+    testTiming();
+
+    return testResult("stable");
+}
@@ -0,0 +1,197 @@
+// statsTest.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// Health counters: every counter is described and printed under its
+// subsystem, the binary frame carries each counter least significant byte
+// first with a valid sum, and automatic reports run on the task timer.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include "test.h"
+#include "tasks.h"
+#include "stats.h"
+
+static char output[1024];
+static uint16_t outputLength = 0;
+static uint8_t raw[64];
+static uint8_t rawLength = 0;
+
+static uint8_t timerTask = 0xFF;
+static uint32_t timerDelay = 0;
+static uint32_t timerPeriod = 0;
+static bool timerActive = false;
+
+//
+// Fakes
+//
+
+SCHEDULER scheduler;
+
+void startTaskTimer(SCHEDULER* s, TASK_TIMER* timer, uint8_t id, uint32_t delay, uint32_t period)
+{
+    timerTask = id;
+    timerDelay = delay;
+    timerPeriod = period;
+    timerActive = true;
+}
+
+void stopTaskTimer(SCHEDULER* s, TASK_TIMER* timer)
+{
+    timerActive = false;
+}
+
+void sendUart0String(char str[])
+{
+    outputLength += snprintf(&output[outputLength], sizeof(output) - outputLength, "%s", str);
+}
+
+void sendUart0StringLiteral(const char str[])
+{
+    sendUart0String((char*)str);
+}
+
+void sendUart0Unsigned(uint32_t value)
+{
+    outputLength += snprintf(&output[outputLength], sizeof(output) - outputLength, "%u", value);
+}
+
+void putcUart0(char c)
+{
+    if(rawLength < sizeof(raw))
+    {
+        raw[rawLength++] = c;
+    }
+}
+
+//
+// Helpers
+//
+
+static void clearOutput(void)
+{
+    outputLength = 0;
+    output[0] = 0;
+    rawLength = 0;
+}
+
+//
+// Tests
+//
+
+static void testCount(void)
+{
+    uint32_t counters[MAX_STATS], state;
+
+    resetStats();
+
+    COUNT_STAT(STAT_TX_FULL);
+    COUNT_STAT(STAT_TX_FULL);
+    COUNT_STAT(STAT_EMITTED);
+    CHECK(hostPrimask == 0);
+
+    // Counting inside a critical section leaves it in place
+    state = _disable_interrupts();
+    COUNT_STAT(STAT_DEADLINES);
+    CHECK(hostPrimask == 1);
+    _restore_interrupts(state);
+
+    copyStats(counters);
+    CHECK(counters[STAT_TX_FULL] == 2 && counters[STAT_EMITTED] == 1 && counters[STAT_DEADLINES] == 1);
+    CHECK(counters[STAT_RX_OVERRUN] == 0 && counters[STAT_SAMPLES] == 0);
+
+    resetStats();
+    copyStats(counters);
+    CHECK(counters[STAT_TX_FULL] == 0 && counters[STAT_EMITTED] == 0 && counters[STAT_DEADLINES] == 0);
+}
+
+// Every counter prints once, under its subsystem
+static void testText(void)
+{
+    uint32_t counters[MAX_STATS];
+    uint8_t i;
+
+    for(i = 0; i < MAX_STATS; i++)
+    {
+        counters[i] = i + 1;
+    }
+
+    clearOutput();
+    printStats(counters);
+
+    CHECK(strcmp(output, "  uart0: tx full 1, rx overruns 2\r\n"
+                         "  timers: deadlines dropped 3\r\n"
+                         "  adc0: reads 4, busy waits 5\r\n"
+                         "  eeprom: words written 6\r\n"
+                         "  led: samples 7, samples emitted 8\r\n") == 0);
+}
+
+static void testBinary(void)
+{
+    uint32_t counters[MAX_STATS] = {0};
+    uint8_t frame[STATS_FRAME_SIZE], sum = 0, i;
+
+    counters[STAT_TX_FULL] = 2;
+    counters[STAT_ADC_WAITS] = 0x12345678;
+
+    CHECK(packStats(counters, frame) == STATS_FRAME_SIZE);
+    CHECK(frame[0] == STATS_SYNC && frame[1] == MAX_STATS && frame[2] == 2);
+    CHECK(frame[2 + (4 * STAT_ADC_WAITS)] == 0x78 && frame[5 + (4 * STAT_ADC_WAITS)] == 0x12);
+
+    for(i = 0; i < STATS_FRAME_SIZE - 1; i++)
+    {
+        sum += frame[i];
+    }
+
+    CHECK(frame[STATS_FRAME_SIZE - 1] == sum);
+
+    // The report sends the same frame of the live counters
+    resetStats();
+    COUNT_STAT(STAT_TX_FULL);
+    COUNT_STAT(STAT_TX_FULL);
+    statCounters[STAT_ADC_WAITS] = 0x12345678;
+
+    clearOutput();
+    reportStats(STATS_BINARY);
+    CHECK(rawLength == STATS_FRAME_SIZE && memcmp(raw, frame, rawLength) == 0 && outputLength == 0);
+}
+
+static void testReports(void)
+{
+    startStatsReport(10);
+    CHECK(timerActive && timerTask == TASK_STATS);
+    CHECK(timerDelay == 10000000 / TASK_TICK && timerPeriod == timerDelay);
+
+    // The longest period still fits the tick count
+    startStatsReport(MAX_STATS_PERIOD);
+    CHECK(timerPeriod == (MAX_STATS_PERIOD * 1000000ull) / TASK_TICK);
+
+    stopStatsReport();
+    CHECK(!timerActive);
+
+    // The task reports in the format chosen
+    statsFormat = STATS_TEXT;
+    clearOutput();
+    statsTask();
+    CHECK(strncmp(output, "  uart0: tx full 2,", 19) == 0 && rawLength == 0);
+}
+
+int main(void)
+{
+    testCount();
+    testText();
+    testBinary();
+    testReports();
+
+    return testResult("stats");
+}
@@ -0,0 +1,289 @@
+// tasksTest.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// Task scheduler on a simulated clock. SysTick fires every TASK_TICK us of
+// simulated time; while interrupts are masked it stays pending until they
+// are restored, and WFI skips ahead to it. The us timestamp counts the
+// sleep, the cycle counter stops in it as the core clock does. Tasks run in priority order
+// and coalesce their events, timers post on the exact tick they are due, and
+// the busy percentage matches the load the tasks spend.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "test.h"
+#include "cycles.h"
+#include "timestamp.h"
+#include "tasks.h"
+
+#define TICK_CYCLES  (TASK_TICK * CYCLES_PER_MICROSECOND)
+#define MAX_LOG      1000
+#define RANDOM_TIMERS 20
+
+static uint32_t now = 0;                        // simulated time in cycles
+static uint32_t slept = 0;                      // cycles in WFI, the cycle counter misses them
+static uint32_t nextTick = TICK_CYCLES;         // cycles when SysTick fires next
+static bool inSysTick = false;
+static bool sleptMasked = true;                 // every WFI ran with interrupts off
+
+// Task runs, in order
+static uint8_t loggedTask[MAX_LOG];
+static uint32_t loggedTick[MAX_LOG];
+static uint32_t logged = 0;
+
+//
+// Fakes
+//
+
+uint32_t readCycleCounter(void) { return now - slept; }
+uint64_t readTimestamp(void) { return now / CYCLES_PER_MICROSECOND; }
+uint32_t cyclesToMicroseconds(uint32_t cycles) { return cycles / CYCLES_PER_MICROSECOND; }
+void sendUart0String(char str[]) {}
+void sendUart0StringLiteral(const char str[]) {}
+void sendUart0Unsigned(uint32_t value) {}
+void sendUart0Fixed(int32_t value, uint8_t decimals) {}
+
+//
+// Helpers
+//
+
+// SysTick ISR, runs every tick that has come while it was masked
+static void sysTick(void)
+{
+    if(!inSysTick)
+    {
+        inSysTick = true;
+
+        while(now >= nextTick)
+        {
+            nextTick += TICK_CYCLES;
+            tickScheduler(&scheduler);
+        }
+
+        inSysTick = false;
+    }
+}
+
+// Sleep until SysTick is pending, it runs once runTasks() unmasks
+static void wfi(void)
+{
+    sleptMasked = sleptMasked && hostPrimask != 0;
+
+    if(now < nextTick)
+    {
+        slept += nextTick - now;
+        now = nextTick;
+    }
+}
+
+// Busy work in a task, with interrupts on
+static void spend(uint32_t cycles)
+{
+    while(now + cycles >= nextTick)
+    {
+        cycles -= nextTick - now;
+        now = nextTick;
+        sysTick();
+    }
+
+    now += cycles;
+}
+
+static void logRun(uint8_t id)
+{
+    if(logged < MAX_LOG)
+    {
+        loggedTask[logged] = id;
+        loggedTick[logged++] = scheduler.now;
+    }
+}
+
+static void task0(void) { logRun(0); spend(TICK_CYCLES / 10); }
+static void task1(void) { logRun(1); spend(TICK_CYCLES / 2); }
+static void task2(void) { logRun(2); }
+
+// Runs a whole tick, for a known load
+static void heavyTask(void) { spend(TICK_CYCLES); }
+
+// Run the main loop until tick
+static void runUntil(uint32_t tick)
+{
+    while(scheduler.now < tick)
+    {
+        runTasks(&scheduler);
+    }
+}
+
+//
+// Tests
+//
+
+static void testPriority(void)
+{
+    registerTask(&scheduler, 0, "a", task0);
+    registerTask(&scheduler, 1, "b", task1);
+    registerTask(&scheduler, 2, "c", task2);
+
+    postTask(&scheduler, 2);
+    postTask(&scheduler, 1);
+    postTask(&scheduler, 0);
+
+    logged = 0;
+    CHECK(runTasks(&scheduler) && runTasks(&scheduler) && runTasks(&scheduler));
+    CHECK(logged == 3 && loggedTask[0] == 0 && loggedTask[1] == 1 && loggedTask[2] == 2);
+
+    // Events posted before a task starts coalesce into one run
+    postTask(&scheduler, 2);
+    postTask(&scheduler, 2);
+    CHECK(runTasks(&scheduler) && !runTasks(&scheduler));
+    CHECK(scheduler.task[2].runs == 2 && scheduler.task[2].posts == 3);
+}
+
+// One-shot, periodic, restarted and stopped timers, each on its exact tick.
+// A period of WHEEL_SLOTS brings a timer back to the same slot every turn.
+static void testTimers(void)
+{
+    TASK_TIMER oneShot = {0}, periodic = {0}, sameSlot = {0}, stopped = {0};
+    uint32_t base = scheduler.now, i, at, runs[3] = {0};
+    bool ok = true;
+
+    startTaskTimer(&scheduler, &oneShot, 2, 5, 0);
+    startTaskTimer(&scheduler, &periodic, 0, 7, 20);
+    startTaskTimer(&scheduler, &sameSlot, 1, 3, WHEEL_SLOTS);
+    startTaskTimer(&scheduler, &stopped, 2, 40, 0);
+    stopTaskTimer(&scheduler, &stopped);
+    startTaskTimer(&scheduler, &oneShot, 2, 9, 0);
+
+    logged = 0;
+    runUntil(base + 100);
+
+    for(i = 0; i < logged; i++)
+    {
+        at = loggedTick[i] - base;
+
+        switch(loggedTask[i])
+        {
+            case 0:
+                ok = ok && at == 7 + (20 * runs[0]);
+                break;
+            case 1:
+                ok = ok && at == 3 + (WHEEL_SLOTS * runs[1]);
+                break;
+            case 2:
+                ok = ok && at == 9;
+                break;
+        }
+
+        runs[loggedTask[i]]++;
+    }
+
+    CHECK(ok);
+    CHECK(runs[0] == 5 && runs[1] == 7 && runs[2] == 1);
+    CHECK(!oneShot.active && !stopped.active && periodic.active);
+
+    stopTaskTimer(&scheduler, &periodic);
+    stopTaskTimer(&scheduler, &sameSlot);
+
+    // A timer many wheel turns away
+    base = scheduler.now;
+    startTaskTimer(&scheduler, &oneShot, 2, 1000, 0);
+
+    logged = 0;
+    runUntil(base + 1100);
+    CHECK(logged == 1 && loggedTick[0] == base + 1000);
+
+    CHECK(sleptMasked);
+}
+
+// Random starts and stops, each tick posts exactly the timers due on it
+static void testRandomTimers(void)
+{
+    TASK_TIMER timer[RANDOM_TIMERS] = {{0}};
+    uint32_t step, posts;
+    uint8_t i, due;
+    bool ok = true;
+
+    for(step = 0; step < 5000; step++)
+    {
+        i = rand() % RANDOM_TIMERS;
+
+        if(rand() % 3 == 0)
+        {
+            stopTaskTimer(&scheduler, &timer[i]);
+        }
+        else
+        {
+            startTaskTimer(&scheduler, &timer[i], 2, rand() % 100, 0);
+        }
+
+        for(i = 0, due = 0; i < RANDOM_TIMERS; i++)
+        {
+            due += timer[i].active && timer[i].due == scheduler.now + 1;
+        }
+
+        posts = scheduler.task[2].posts;
+        tickScheduler(&scheduler);
+        ok = ok && scheduler.task[2].posts - posts == due;
+
+        for(i = 0; i < RANDOM_TIMERS; i++)
+        {
+            ok = ok && !(timer[i].active && (int32_t)(timer[i].due - scheduler.now) <= 0);
+        }
+    }
+
+    CHECK(ok);
+
+    for(i = 0; i < RANDOM_TIMERS; i++)
+    {
+        stopTaskTimer(&scheduler, &timer[i]);
+    }
+
+    // The ticks above took no simulated time
+    nextTick = now + TICK_CYCLES;
+    scheduler.windowStart = readTimestamp();
+    scheduler.windowTicks = 0;
+    scheduler.idleTime = 0;
+}
+
+// A whole tick of work every fourth tick is 25% busy
+static void testLoad(void)
+{
+    TASK_TIMER timer = {0};
+
+    registerTask(&scheduler, 1, "heavy", heavyTask);
+    scheduler.ready = 0;
+
+    runUntil(scheduler.now + LOAD_WINDOW - scheduler.windowTicks);
+    startTaskTimer(&scheduler, &timer, 1, 4, 4);
+    runUntil(scheduler.now + (2 * LOAD_WINDOW));
+
+    CHECK(scheduler.busy == 2500);
+    CHECK(scheduler.peakBusy >= 2500);
+
+    stopTaskTimer(&scheduler, &timer);
+    runUntil(scheduler.now + (2 * LOAD_WINDOW));
+    CHECK(scheduler.busy == 0);
+}
+
+int main(void)
+{
+    srand(45);
+    hostPreempt = sysTick;
+    hostWfi = wfi;
+
+    testPriority();
+    testTimers();
+    testRandomTimers();
+    testLoad();
+
+    return testResult("tasks");
+}
@@ -0,0 +1,46 @@
+// test.h
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// Minimal checks for the host tests. A failed CHECK prints its condition and
+// the test carries on, testResult() reports the total as the exit status.
+
+#ifndef TEST_H_
+#define TEST_H_
+
+#include <stdio.h>
+
+static int testChecks = 0;
+static int testFailures = 0;
+
+#define CHECK(condition) \
+    do \
+    { \
+        testChecks++; \
+        if(!(condition)) \
+        { \
+            testFailures++; \
+            printf("  %s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+        } \
+    } while(0)
+
+// Print a measurement, such as a timing, indented under the test
+#define REPORT(...) printf("  " __VA_ARGS__)
+
+// Print a summary line, returns the process exit status
+static inline int testResult(const char name[])
+{
+    printf("%s: %d checks, %d failed\n", name, testChecks, testFailures);
+
+    return testFailures > 0;
+}
+
+#endif /* TEST_H_ */
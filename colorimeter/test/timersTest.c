@@ -0,0 +1,218 @@
+// timersTest.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// Sampling period set up: long periods split into the fewest equal timer
+// ticks with no drift, and every start checked against the measurement time.
+// Holding samples off for a command masks no interrupt and loses no deadline.
+// The Timer2 alarm counts down to its deadline and runs its handler once.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "test.h"
+#include "tm4c123gh6pm.h"
+#include "cycles.h"
+#include "eeprom.h"
+#include "interrupts.h"
+#include "schedule.h"
+#include "stats.h"
+#include "tasks.h"
+#include "timers.h"
+
+static uint32_t measurement = 5000;             // us, what measurementTime() returns
+static uint32_t posted = 0;                     // deferred work posted
+static DEFERRED_WORK lastPosted = 0;
+static uint32_t now = 0;                        // simulated cycle counter
+static uint32_t alarms = 0;                     // alarm handler runs
+
+//
+// Fakes
+//
+
+SCHEDULE schedule;
+SCHEDULER scheduler;
+INTERRUPT_STATS interruptStats;
+uint32_t settleTime;
+bool validCalibration = true;
+
+uint32_t measurementTime(void) { return measurement; }
+void startMeasurement(uint32_t settle, void (*done)(void)) { done(); }
+void reportMeasurement(void) {}
+void getMeasurement(void) {}
+void resetSchedule(SCHEDULE* schedule, uint32_t period) {}
+uint8_t checkSchedule(SCHEDULE* schedule, uint64_t deadline, uint64_t end, uint32_t settle) { return 0; }
+uint64_t readTimestamp(void) { return now / CYCLES_PER_MICROSECOND; }
+bool deferWork(DEFERRED_WORK work)
+{
+    posted++;
+    lastPosted = work;
+
+    return true;
+}
+
+void recordLatency(uint32_t* worst, uint32_t cycles) {}
+void countStat(uint8_t stat) {}
+uint32_t maskInterrupts(uint8_t priority) { return 0; }
+void unmaskInterrupts(uint32_t state) {}
+void tickScheduler(SCHEDULER* s) {}
+uint32_t readCycleCounter(void) { return now; }
+void sendUart0String(char str[]) {}
+void sendUart0Unsigned(uint32_t value) {}
+
+//
+// Helpers
+//
+
+static void countAlarm(void)
+{
+    alarms++;
+}
+
+//
+// Tests
+//
+
+// A period splits into ticks that fit the 32-bit timer, as few as possible,
+// and ticks * (load + 1) is the period to within one cycle per tick
+static void testSplitPeriod(void)
+{
+    static const uint32_t periods[] = {1000, 1001, 20000, 100000, 53687091, 53687092,
+                                       107374182, 107374183, 1000000000, 4000000000u, UINT32_MAX};
+    uint64_t cycles, split;
+    uint32_t load, i, period;
+    uint16_t ticks;
+    bool ok = true;
+
+    for(i = 0; i < 200000; i++)
+    {
+        period = (i < sizeof(periods) / sizeof(periods[0])) ? periods[i]
+                 : MIN_PERIOD + (((uint64_t)i * 2654435761u) % (UINT32_MAX - MIN_PERIOD));
+        cycles = (uint64_t)period * CYCLES_PER_MICROSECOND;
+        ticks = splitPeriod(period, &load);
+        split = (uint64_t)ticks * ((uint64_t)load + 1);
+
+        ok = ok && ticks >= 1
+                && ((cycles - 1) >> 32) + 1 == ticks
+                && (split > cycles ? split - cycles : cycles - split) <= ticks;
+    }
+
+    CHECK(ok);
+
+    ticks = splitPeriod(100000, &load);
+    CHECK(ticks == 1 && load == (100000 * CYCLES_PER_MICROSECOND) - 1);
+}
+
+// Every start goes through the measurement time check
+static void testStartPeriodic(void)
+{
+    periodicValue = 100000;
+    measurement = 5000;
+
+    CHECK(!startPeriodic(4999));
+    CHECK(!periodicMode && periodicValue == 100000);
+
+    CHECK(startPeriodic(5000));
+    CHECK(periodicMode && periodicValue == 5000 && (TIMER1_CTL_R & TIMER_CTL_TAEN));
+
+    // Never below MIN_PERIOD, however quick a measurement is
+    disableIntTimer1();
+    measurement = 10;
+    CHECK(!startPeriodic(MIN_PERIOD - 1));
+    CHECK(startPeriodic(MIN_PERIOD));
+
+    // A longer settle time makes the configured period too short, match and
+    // delta restart sampling with it and are refused too
+    disableIntTimer1();
+    measurement = 20000;
+    CHECK(!startPeriodic(periodicValue));
+    CHECK(!periodicMode);
+
+    periodicT(0);
+    CHECK(!periodicMode && !(TIMER1_CTL_R & TIMER_CTL_TAEN));
+}
+
+// A deadline during a hold is kept for the release, once
+static void testHold(void)
+{
+    bool held;
+
+    measurement = 1000;
+    CHECK(startPeriodic(20000));
+
+    posted = 0;
+    timer1Isr();
+    CHECK(posted == 1);
+
+    // Nothing is masked while the command runs
+    held = holdSampling();
+    CHECK(!held && hostPrimask == 0 && hostBasepri == 0);
+
+    posted = 0;
+    timer1Isr();
+    timer1Isr();
+    CHECK(posted == 0);
+
+    releaseSampling(held);
+    CHECK(posted == 1 && hostPrimask == 0);
+
+    // The sample posted at the release runs as usual
+    lastPosted();
+
+    // Without a deadline in between, the release posts nothing
+    posted = 0;
+    releaseSampling(holdSampling());
+    CHECK(posted == 0);
+
+    // Nor when the command stopped sampling
+    held = holdSampling();
+    timer1Isr();
+    periodicT(0);
+    releaseSampling(held);
+    CHECK(posted == 0);
+}
+
+static void testAlarm(void)
+{
+    now = 0xFFFFF000;
+
+    // The timer counts the cycles left to the deadline, across the wrap
+    setAlarm(now + 10000, countAlarm);
+    CHECK(TIMER2_TAILR_R == 10000 - 1 && TIMER2_TAV_R == TIMER2_TAILR_R);
+    CHECK((TIMER2_CTL_R & TIMER_CTL_TAEN) && hostPrimask == 0);
+
+    alarms = 0;
+    timer2Isr();
+    CHECK(alarms == 1);
+
+    // A spurious timeout after the alarm ran does nothing
+    timer2Isr();
+    CHECK(alarms == 1);
+
+    // A deadline already passed fires after MIN_ALARM
+    setAlarm(now - 100, countAlarm);
+    CHECK(TIMER2_TAILR_R == MIN_ALARM);
+
+    // A cancelled alarm never runs
+    cancelAlarm();
+    CHECK(!(TIMER2_CTL_R & TIMER_CTL_TAEN));
+    timer2Isr();
+    CHECK(alarms == 1);
+}
+
+int main(void)
+{
+    testSplitPeriod();
+    testStartPeriodic();
+    testHold();
+    testAlarm();
+
+    return testResult("timers");
+}
@@ -0,0 +1,209 @@
+// timestampTest.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// 64-bit us clock from a 32-bit down counter and its wrap ISR. The ISR may
+// run up to 50 ms after a wrap; a stamp read in between must still come out
+// as the true time, and never go back by a wrap. Stamps print as seconds
+// with six decimals.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test.h"
+#include "tm4c123gh6pm.h"
+#include "clock.h"
+#include "timestamp.h"
+
+#define MAX_LAG      50000                      // us, latest the wrap ISR runs
+
+static char output[64];
+static uint8_t outputLength = 0;
+
+//
+// Fakes
+//
+
+void putcUart0(char c)
+{
+    if(outputLength < sizeof(output) - 1)
+    {
+        output[outputLength++] = c;
+        output[outputLength] = 0;
+    }
+}
+
+void sendUart0String(char str[])
+{
+    while(*str)
+    {
+        putcUart0(*str++);
+    }
+}
+
+uint8_t formatUnsigned(char str[], uint32_t value)
+{
+    return sprintf(str, "%u", value);
+}
+
+void sendUart0Unsigned(uint32_t value)
+{
+    char str[16];
+
+    formatUnsigned(str, value);
+    sendUart0String(str);
+}
+
+//
+// Helpers
+//
+
+static uint64_t random64(void)
+{
+    return ((uint64_t)rand() << 40) ^ ((uint64_t)rand() << 20) ^ rand();
+}
+
+// Extend the time the timer shows at true time, with the wrap ISR lag us late
+static uint64_t extendAt(uint64_t time, uint32_t lag)
+{
+    uint32_t wraps = time >> 32;
+    uint32_t low = (uint32_t)time;
+    bool serviced = wraps == 0 || low >= lag;
+
+    return extendTimestamp(serviced ? wraps : wraps - 1, 0xFFFFFFFF - low, !serviced);
+}
+
+static bool printsAs(uint64_t time, const char expected[])
+{
+    outputLength = 0;
+    output[0] = 0;
+    sendUart0Timestamp(time);
+
+    return strcmp(output, expected) == 0;
+}
+
+//
+// Tests
+//
+
+// Random times, half of them within 2 ms of a wrap
+static void testExtend(void)
+{
+    uint64_t time;
+    uint32_t i, low;
+    bool ok = true, between = true;
+
+    for(i = 0; i < 2000000; i++)
+    {
+        if(i % 2)
+        {
+            time = random64() % ((uint64_t)1 << 44);
+        }
+        else
+        {
+            time = ((uint64_t)(1 + (rand() % 4096)) << 32) + (uint32_t)(0xFFFFF830 + (rand() % 4000));
+        }
+
+        ok = ok && extendAt(time, rand() % MAX_LAG) == time;
+
+        // A wrap lands after the count is read and before the flag is: the
+        // count is from before the wrap, the flag already set
+        low = (uint32_t)time;
+        if(low >= 0xFFFFFFFF - 100)
+        {
+            between = between && extendTimestamp(time >> 32, 0xFFFFFFFF - low, true) == time;
+        }
+    }
+
+    CHECK(ok);
+    CHECK(between);
+}
+
+// Rising time across three wraps, the ISR lagging a random time each wrap
+static void testMonotonic(void)
+{
+    uint64_t time, stamp, last = 0;
+    uint32_t high = 0, lag = 0;
+    bool pending = false, ok = true;
+
+    for(time = 0xFFFF0000ull; time < 0x300010000ull && ok; time += 1 + (rand() % 997))
+    {
+        if((time >> 32) > high && !pending)
+        {
+            pending = true;
+            lag = rand() % MAX_LAG;
+        }
+
+        if(pending && (uint32_t)time >= lag)
+        {
+            high = time >> 32;
+            pending = false;
+        }
+
+        stamp = extendTimestamp(high, 0xFFFFFFFF - (uint32_t)time, pending);
+        ok = stamp == time && stamp >= last;
+        last = stamp;
+    }
+
+    CHECK(ok);
+}
+
+// readTimestamp() takes the wraps, the count and the pending flag together
+static void testRead(void)
+{
+    initTimestamp();
+    CHECK(WTIMER0_TAPR_R == SYSTEM_CLOCK_MHZ - 1);
+
+    WTIMER0_TAV_R = 0xFFFFFFFF - 1234;
+    CHECK(readTimestamp() == 1234);
+
+    WTIMER0_TAV_R = 0xFFFFFFFF - 10;
+    WTIMER0_RIS_R = TIMER_RIS_TATORIS;
+    CHECK(readTimestamp() == 0x10000000Aull);
+
+    wideTimer0Isr();
+    WTIMER0_RIS_R = 0;
+    CHECK(readTimestamp() == 0x10000000Aull);
+    CHECK(hostPrimask == 0);
+}
+
+static void testFormat(void)
+{
+    CHECK(printsAs(0, "0.000000"));
+    CHECK(printsAs(7, "0.000007"));
+    CHECK(printsAs(1000000, "1.000000"));
+    CHECK(printsAs(123456789, "123.456789"));
+    CHECK(printsAs(((uint64_t)3 << 32) + 5, "12884.901893"));
+
+    stampMode = false;
+    outputLength = 0;
+    sendUart0Stamp(5, ',');
+    CHECK(outputLength == 0);
+
+    stampMode = true;
+    outputLength = 0;
+    sendUart0Stamp(1500000, ' ');
+    CHECK(strcmp(output, "1.500000 ") == 0);
+}
+
+int main(void)
+{
+    srand(48);
+
+    testExtend();
+    testMonotonic();
+    testRead();
+    testFormat();
+
+    return testResult("timestamp");
+}
@@ -0,0 +1,164 @@
+// tm4c123gh6pm.h
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// Host stand-in for TI's device header, found before it on the include
+// path. Each register the tested modules touch is a plain variable defined
+// in host.c; the bit values are TI's.
+
+#ifndef TM4C123GH6PM_H_
+#define TM4C123GH6PM_H_
+
+#include <stdint.h>
+
+#ifndef HOST_REGISTER
+#define HOST_REGISTER(name) extern volatile uint32_t name
+#endif
+
+// System control
+HOST_REGISTER(SYSCTL_RCC_R);
+HOST_REGISTER(SYSCTL_RCC2_R);
+HOST_REGISTER(SYSCTL_RIS_R);
+
+#define SYSCTL_RCC_USESYSDIV    0x00400000
+#define SYSCTL_RCC_USEPWMDIV    0x00100000
+#define SYSCTL_RCC_PWMDIV_M     0x000E0000
+#define SYSCTL_RCC_PWMDIV_S     17
+#define SYSCTL_RCC_XTAL_16MHZ   0x00000540
+#define SYSCTL_RCC_OSCSRC_MAIN  0x00000000
+#define SYSCTL_RCC2_USERCC2     0x80000000
+#define SYSCTL_RCC2_DIV400      0x40000000
+#define SYSCTL_RCC2_SYSDIV2_M   0x1F800000
+#define SYSCTL_RCC2_SYSDIV2LSB  0x00400000
+#define SYSCTL_RCC2_SYSDIV2_S   23
+#define SYSCTL_RCC2_BYPASS2     0x00000800
+#define SYSCTL_RCC2_OSCSRC2_MO  0x00000000
+#define SYSCTL_RIS_PLLLRIS      0x00000040
+
+// Timers
+HOST_REGISTER(SYSCTL_RCGCTIMER_R);
+HOST_REGISTER(TIMER1_CFG_R);
+HOST_REGISTER(TIMER1_CTL_R);
+HOST_REGISTER(TIMER1_ICR_R);
+HOST_REGISTER(TIMER1_IMR_R);
+HOST_REGISTER(TIMER1_TAILR_R);
+HOST_REGISTER(TIMER1_TAMR_R);
+HOST_REGISTER(TIMER1_TAV_R);
+HOST_REGISTER(TIMER2_CFG_R);
+HOST_REGISTER(TIMER2_CTL_R);
+HOST_REGISTER(TIMER2_ICR_R);
+HOST_REGISTER(TIMER2_IMR_R);
+HOST_REGISTER(TIMER2_TAILR_R);
+HOST_REGISTER(TIMER2_TAMR_R);
+HOST_REGISTER(TIMER2_TAV_R);
+HOST_REGISTER(SYSCTL_RCGCWTIMER_R);
+HOST_REGISTER(WTIMER0_CFG_R);
+HOST_REGISTER(WTIMER0_CTL_R);
+HOST_REGISTER(WTIMER0_ICR_R);
+HOST_REGISTER(WTIMER0_IMR_R);
+HOST_REGISTER(WTIMER0_RIS_R);
+HOST_REGISTER(WTIMER0_TAILR_R);
+HOST_REGISTER(WTIMER0_TAMR_R);
+HOST_REGISTER(WTIMER0_TAPR_R);
+HOST_REGISTER(WTIMER0_TAV_R);
+
+#define SYSCTL_RCGCTIMER_R1     0x00000002
+#define SYSCTL_RCGCTIMER_R2     0x00000004
+#define SYSCTL_RCGCWTIMER_R0    0x00000001
+#define TIMER_CFG_32_BIT_TIMER  0x00000000
+#define TIMER_CFG_16_BIT        0x00000004
+#define TIMER_CTL_TAEN          0x00000001
+#define TIMER_ICR_TATOCINT      0x00000001
+#define TIMER_IMR_TATOIM        0x00000001
+#define TIMER_RIS_TATORIS       0x00000001
+#define TIMER_TAMR_TAMR_1_SHOT  0x00000001
+#define TIMER_TAMR_TAMR_PERIOD  0x00000002
+
+// NVIC and SysTick
+HOST_REGISTER(NVIC_EN0_R);
+HOST_REGISTER(NVIC_EN2_R);
+HOST_REGISTER(NVIC_INT_CTRL_R);
+HOST_REGISTER(NVIC_SYS_PRI3_R);
+HOST_REGISTER(NVIC_ST_CTRL_R);
+HOST_REGISTER(NVIC_ST_CURRENT_R);
+HOST_REGISTER(NVIC_ST_RELOAD_R);
+
+// The priority registers are contiguous, interrupts.c indexes them by byte
+extern volatile uint32_t hostNvicPri[35];
+#define NVIC_PRI0_R             (hostNvicPri[0])
+
+#define NVIC_ST_CTRL_CLK_SRC    0x00000004
+#define NVIC_ST_CTRL_INTEN      0x00000002
+#define NVIC_ST_CTRL_ENABLE     0x00000001
+#define NVIC_INT_CTRL_PEND_SV   0x10000000
+#define NVIC_SYS_PRI3_TICK_M    0xE0000000
+#define NVIC_SYS_PRI3_TICK_S    29
+#define NVIC_SYS_PRI3_PENDSV_M  0x00E00000
+#define NVIC_SYS_PRI3_PENDSV_S  21
+
+#define INT_GPIOA               16
+#define INT_UART0               21
+#define INT_ADC0SS3             33
+#define INT_TIMER1A             37
+#define INT_TIMER2A             39
+#define INT_GPIOF               46
+#define INT_WTIMER0A            110
+
+// UART0. The data register is a hook the test defines, so a write can start
+// the simulated transmitter.
+volatile uint32_t* hostUart0Data(void);
+#define UART0_DR_R              (*hostUart0Data())
+
+HOST_REGISTER(SYSCTL_RCGCUART_R);
+HOST_REGISTER(UART0_CC_R);
+HOST_REGISTER(UART0_CTL_R);
+HOST_REGISTER(UART0_FBRD_R);
+HOST_REGISTER(UART0_FR_R);
+HOST_REGISTER(UART0_IBRD_R);
+HOST_REGISTER(UART0_ICR_R);
+HOST_REGISTER(UART0_IM_R);
+HOST_REGISTER(UART0_LCRH_R);
+HOST_REGISTER(UART0_MIS_R);
+
+#define SYSCTL_RCGCUART_R0      0x00000001
+#define GPIO_PCTL_PA0_U0RX      0x00000001
+#define GPIO_PCTL_PA1_U0TX      0x00000010
+#define UART_CC_CS_SYSCLK       0x00000000
+#define UART_CTL_RXE            0x00000200
+#define UART_CTL_TXE            0x00000100
+#define UART_CTL_UARTEN         0x00000001
+#define UART_FR_TXFE            0x00000080
+#define UART_FR_RXFE            0x00000010
+#define UART_ICR_RTIC           0x00000040
+#define UART_ICR_RXIC           0x00000010
+#define UART_ICR_TXIC           0x00000020
+#define UART_IM_OEIM            0x00000400
+#define UART_IM_RXIM            0x00000010
+#define UART_IM_TXIM            0x00000020
+#define UART_LCRH_WLEN_8        0x00000060
+#define UART_MIS_OEMIS          0x00000400
+#define UART_MIS_RXMIS          0x00000010
+
+// EEPROM. The data registers are a hook the test defines, returning the word
+// EEBLOCK and EEOFFSET select in its simulated EEPROM; for the auto-increment
+// register it moves EEOFFSET on within the block.
+volatile uint32_t* hostEepromWord(uint8_t increment);
+#define EEPROM_EERDWR_R         (*hostEepromWord(0))
+#define EEPROM_EERDWRINC_R      (*hostEepromWord(1))
+
+HOST_REGISTER(SYSCTL_RCGCEEPROM_R);
+HOST_REGISTER(EEPROM_EEBLOCK_R);
+HOST_REGISTER(EEPROM_EEOFFSET_R);
+HOST_REGISTER(EEPROM_EEDONE_R);
+
+#define EEPROM_EEDONE_WORKING   0x00000001
+
+#endif /* TM4C123GH6PM_H_ */
@@ -0,0 +1,177 @@
+// uart0Test.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// Tx ring shared by the shell and the sampling ISR. Wherever the firmware
+// unmasks interrupts, the simulated UART may shift a character out, the UART
+// ISR may run, and the timer ISR may print a sample line. Every character of
+// both writers must come out once, the shell's in order and each sample line
+// whole.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test.h"
+#include "tm4c123gh6pm.h"
+#include "gpio.h"
+#include "stats.h"
+#include "tasks.h"
+#include "uart0.h"
+
+#define SHELL_LINES  3000
+#define MAX_OUTPUT   400000
+
+static uint32_t dataRegister;
+static bool txBusy = false;                     // a character waits in the holding register
+static char output[MAX_OUTPUT];
+static uint32_t outputLength = 0;
+static bool inTimerIsr = false;
+static uint32_t sampleLines = 0;
+
+//
+// Fakes
+//
+
+SCHEDULER scheduler;
+
+volatile uint32_t* hostUart0Data(void)
+{
+    // Only writes happen in this test, each loads the holding register
+    txBusy = true;
+    UART0_FR_R &= ~UART_FR_TXFE;
+
+    return &dataRegister;
+}
+
+void enablePort(PORT port) {}
+void selectPinPushPullOutput(PORT port, uint8_t pin) {}
+void selectPinDigitalInput(PORT port, uint8_t pin) {}
+void setPinAuxFunction(PORT port, uint8_t pin, uint32_t fn) {}
+void postTask(SCHEDULER* s, uint8_t id) {}
+void recordProbe(uint8_t probe, uint32_t cycles) {}
+void countStat(uint8_t stat) {}
+uint32_t readCycleCounter(void) { return 0; }
+
+//
+// Helpers
+//
+
+// The UART shifts out the holding register
+static void shiftOut(void)
+{
+    if(txBusy && outputLength < MAX_OUTPUT)
+    {
+        output[outputLength++] = (char)dataRegister;
+        txBusy = false;
+        UART0_FR_R |= UART_FR_TXFE;
+    }
+}
+
+static void sampleLine(char line[], uint32_t number)
+{
+    sprintf(line, "#sample %05u\r\n", number);
+}
+
+// Interrupts that may be pending when the firmware unmasks
+static void preempt(void)
+{
+    char line[20];
+
+    if(rand() % 3 == 0)
+    {
+        shiftOut();
+
+        if(rand() % 2)
+        {
+            uart0Isr();
+        }
+    }
+
+    // The timer ISR prints a whole sample line, only the UART preempts it
+    if(!inTimerIsr && rand() % 150 == 0)
+    {
+        inTimerIsr = true;
+        sampleLine(line, sampleLines++);
+        sendUart0String(line);
+        inTimerIsr = false;
+    }
+}
+
+static void shellLine(char line[], uint32_t number)
+{
+    sprintf(line, "  print colors reply %u abcdefghij\r\n", number);
+}
+
+//
+// Tests
+//
+
+static void testSharedRing(void)
+{
+    static char expected[MAX_OUTPUT], shell[MAX_OUTPUT];
+    char line[64];
+    uint32_t i, shellLength = 0, expectedLength = 0, samples = 0;
+    bool whole = true;
+
+    UART0_FR_R = UART_FR_TXFE;
+    hostPreempt = preempt;
+
+    for(i = 0; i < SHELL_LINES; i++)
+    {
+        shellLine(line, i);
+        sendUart0String(line);
+    }
+
+    hostPreempt = 0;
+
+    for(i = 0; i < MAX_OUTPUT && (!emptyRingBuffer() || txBusy); i++)
+    {
+        shiftOut();
+        uart0Isr();
+    }
+
+    // Take the sample lines out, each must be whole and in turn
+    for(i = 0; i < outputLength; i++)
+    {
+        if(output[i] == '#')
+        {
+            sampleLine(line, samples++);
+            whole = whole && strncmp(&output[i], line, strlen(line)) == 0;
+            i += strlen(line) - 1;
+        }
+        else
+        {
+            shell[shellLength++] = output[i];
+        }
+    }
+
+    for(i = 0; i < SHELL_LINES; i++)
+    {
+        shellLine(&expected[expectedLength], i);
+        expectedLength += strlen(&expected[expectedLength]);
+    }
+
+    CHECK(sampleLines > 0);
+    CHECK(whole && samples == sampleLines);
+    CHECK(shellLength == expectedLength && memcmp(shell, expected, shellLength) == 0);
+    CHECK(hostPrimask == 0);
+}
+
+int main(void)
+{
+    srand(43);
+
+    testSharedRing();
+
+    return testResult("uart0");
+}
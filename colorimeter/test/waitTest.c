@@ -0,0 +1,138 @@
+// waitTest.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: host PC, gcc
+// Target uC:       none, stands in for the TM4C123GH6PM
+// System Clock:    n/a
+
+// Deadline waits on a simulated cycle counter. Each read costs a few cycles
+// of loop, and an ISR burst may preempt the loop between reads. No wait may
+// end early, and an ISR may only delay the end of a wait, not stretch it.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "test.h"
+#include "wait.h"
+
+#define LOOP_CYCLES  8                          // per deadline check
+#define MAX_BURST    2000                       // cycles, longest ISR
+#define LONG_LOOP    100000                     // cycles per check of the long wait, to keep it quick
+
+static uint32_t now = 0;                        // simulated cycle counter
+static uint64_t elapsed = 0;                    // cycles since the test started, never wraps
+static uint16_t load = 0;                       // chance of an ISR after a read, per 1000
+static uint32_t loop = LOOP_CYCLES;             // cycles per check
+
+//
+// Fakes
+//
+
+uint32_t readCycleCounter(void)
+{
+    uint32_t count = now;
+    uint32_t burst = loop;
+
+    if(load > 0 && rand() % 1000 < load)
+    {
+        burst += rand() % MAX_BURST;
+    }
+
+    now += burst;
+    elapsed += burst;
+
+    return count;
+}
+
+//
+// Tests
+//
+
+// Random waits from random starts, the counter wrap included
+static void testWaits(void)
+{
+    uint32_t i, us, start, cycles, over, worst = 0;
+    bool early = false;
+
+    for(load = 0; load <= 200; load += 50)
+    {
+        for(i = 0; i < 2000; i++)
+        {
+            us = 1 + (rand() % 2000);
+            now = start = ((uint32_t)rand() << 16) ^ rand();
+
+            waitMicrosecond(us);
+
+            cycles = now - start;
+            early = early || cycles < us * CYCLES_PER_MICROSECOND;
+            over = cycles - (us * CYCLES_PER_MICROSECOND);
+            worst = (over > worst) ? over : worst;
+        }
+    }
+
+    CHECK(!early);
+
+    // At worst a burst just before the check that passes and one after it
+    CHECK(worst <= (2 * (MAX_BURST + LOOP_CYCLES)));
+}
+
+// Waits longer than MAX_DEADLINE run as consecutive deadlines
+static void testLongWait(void)
+{
+    uint64_t start, cycles;
+
+    load = 0;
+    loop = LONG_LOOP;
+    now = 0xFFFF0000;
+    start = elapsed;
+
+    waitMicrosecond(120000000);
+
+    cycles = elapsed - start;
+    CHECK(cycles >= 120000000ull * CYCLES_PER_MICROSECOND);
+    CHECK(cycles - (120000000ull * CYCLES_PER_MICROSECOND) <= 4 * LONG_LOOP);
+
+    loop = LOOP_CYCLES;
+}
+
+static void testDeadlines(void)
+{
+    uint32_t deadline;
+
+    load = 0;
+
+    // Across the counter wrap
+    now = 0xFFFFFFF0;
+    deadline = deadlineAfter(1);
+    CHECK(deadline < 0xFFFFFFF0 && !deadlinePassed(deadline));
+
+    now = deadline - 1;
+    CHECK(!deadlinePassed(deadline));
+    now = deadline;
+    CHECK(deadlinePassed(deadline));
+
+    // A passed deadline stays passed for MAX_DEADLINE
+    now = deadline + (MAX_DEADLINE * CYCLES_PER_MICROSECOND);
+    CHECK(deadlinePassed(deadline));
+
+    // waitUntil() returns straight away for a passed deadline
+    now = deadline + 1000;
+    waitUntil(deadline);
+    CHECK(now == deadline + 1000 + LOOP_CYCLES);
+}
+
+int main(void)
+{
+    srand(46);
+
+    testWaits();
+    testLongWait();
+    testDeadlines();
+
+    return testResult("wait");
+}
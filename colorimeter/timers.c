@@ -1,94 +1,365 @@
-// timers.c
-// William Bozarth
-// Created on: October 7, 2020
-
-//-----------------------------------------------------------------------------
-// Hardware Target
-//-----------------------------------------------------------------------------
-
-// Target Platform: EK-TM4C123GXL Evaluation Board
-// Target uC:       TM4C123GH6PM
-// System Clock:    40 MHz
-
-#include <stdint.h>
-#include <stdio.h>
-#include <string.h>
-#include <stdbool.h>
-#include "tm4c123gh6pm.h"
-#include "uart0.h"
-#include "gpio.h"
-#include "led.h"
-#include "eeprom.h"
-#include "timers.h"
-
-bool periodicMode = false;
-
-// Function To Initialize Timers
-void initTimer1(void)
-{
-    // Enable clocks
-    SYSCTL_RCGCTIMER_R |= SYSCTL_RCGCTIMER_R1;
-    _delay_cycles(3);
-}
-
-// Enter info for  TIMER1 Interrupt Service Routine here
-void timer1Isr(void)
-{
-    if(periodicMode)
-    {
-        // reset counter for next period
-        TIMER1_TAV_R = 0;
-
-        // get rgb triplet measurement and display
-        getMeasurement();
-    }
-
-    // clear interrupt flag
-    TIMER1_ICR_R = TIMER_ICR_TATOCINT;
-}
-
-// Placeholder random number function
-uint32_t random32(void)
-{
-    return TIMER1_TAV_R;
-}
-
-//function to set the period between measurements
-void periodicT(uint16_t period)
-{
-    // If value of str is '0' or 'off' then deactivate periodic T
-    if(period == 0)
-    {
-        disableIntTimer1();
-        sendUart0String("  periodic T function is OFF\r\n");
-    }
-    // If value of str is between 1... 255 then store loadValue in TIMER1_TAILR_R,
-    // set timeMode to false, periodicMode to true, and turn on Wide5Timer as a counter.
-    else if(period >= 1 && period <= 255)
-    {
-        enableIntTimer1(period);
-    }
-}
-
-// Turn-ON vector number 37 (Interrupt 21) for TIMER1A
-void disableIntTimer1(void)
-{
-    TIMER1_CTL_R &= ~TIMER_CTL_TAEN;      // Turn-off timer before reconfiguring
-    TIMER1_IMR_R &= ~TIMER_IMR_TATOIM;
-    NVIC_EN0_R   &= ~(1 << (INT_TIMER1A - INT_GPIOA));
-    periodicMode = false;
-}
-
-// Turn-ON vector number 37 (Interrupt 21) for TIMER1A
-void enableIntTimer1(uint16_t period)
-{
-    TIMER1_CTL_R   &= ~TIMER_CTL_TAEN;       // Turn-off timer before reconfiguring
-    TIMER1_CFG_R   = TIMER_CFG_32_BIT_TIMER; // Configure as 32-bit timer (A+B)
-    TIMER1_TAMR_R  = TIMER_TAMR_TAMR_PERIOD; // Configure for periodic mode (count down)
-    TIMER1_TAILR_R = (period * 4000000);     // Multiply fc = 40MHz by resolution in units of 0.1s (4,000,000 = 40MHz*0.1)
-    TIMER1_IMR_R   = TIMER_IMR_TATOIM;       // turn-on interrupts
-    TIMER1_TAV_R   = 0;
-    NVIC_EN0_R     |= (1 << (INT_TIMER1A - INT_GPIOA)); // Turn-on vector number 37, or interrupt 21, (TIMER1A)
-    TIMER1_CTL_R   |= TIMER_CTL_TAEN;        // Turn-on timer
-    periodicMode = true;
-}
+// timers.c
+// William Bozarth
+// Created on: October 7, 2020
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include "tm4c123gh6pm.h"
+#include "uart0.h"
+#include "gpio.h"
+#include "led.h"
+#include "eeprom.h"
+#include "format.h"
+#include "cycles.h"
+#include "schedule.h"
+#include "interrupts.h"
+#include "tasks.h"
+#include "stats.h"
+#include "timestamp.h"
+#include "timers.h"
+
+bool periodicMode = false;
+uint32_t periodicValue = 100000;
+
+// Timer1 interrupts per period, and those left until the next sample
+static uint16_t periodTicks = 1;
+static uint16_t tickCount = 0;
+static volatile bool sampling = false;
+static volatile bool held = false;               // a command holds samples off
+static volatile bool heldDeadline = false;       // a deadline came while held
+static uint64_t sampleDeadline;                  // us timestamp, timeout of the sample's period
+
+// Handler of the pending alarm, 0 when none is set
+static ALARM_HANDLER alarmHandler = 0;
+
+// Function To Initialize Timers
+void initTimer1(void)
+{
+    // Enable clocks
+    SYSCTL_RCGCTIMER_R |= SYSCTL_RCGCTIMER_R1;
+    _delay_cycles(3);
+}
+
+// Program the timer for a period in us, split into ticks if needed
+static void loadPeriod(uint32_t period)
+{
+    uint32_t load;
+
+    periodTicks = splitPeriod(period, &load);
+    tickCount = 0;
+    TIMER1_TAILR_R = load;
+}
+
+// End a periodic sample that was due at sampleDeadline
+static void endSample(void)
+{
+    uint32_t state;
+
+    sampling = false;
+
+    // Deadlines that passed during the sample were dropped by the ISR, the
+    // policy may adapt the schedule
+    if(checkSchedule(&schedule, sampleDeadline, readTimestamp(), settleTime) == SCHEDULE_STRETCHED)
+    {
+        state = maskInterrupts(PRIORITY_TIMER1);
+        loadPeriod(schedule.period);
+        TIMER1_TAV_R = TIMER1_TAILR_R;           // next deadline one new period away
+        unmaskInterrupts(state);
+    }
+}
+
+// Report a sample once its last channel is measured, run from PendSV
+static void finishSample(void)
+{
+    reportMeasurement();
+    endSample();
+}
+
+// Take a periodic sample, run as deferred work from PendSV. The channels are
+// measured by alarms as the sensor settles, so nothing waits in between.
+static void takeSample(void)
+{
+    if(!periodicMode)
+    {
+        return;
+    }
+
+    sampling = true;
+
+    if(validCalibration)
+    {
+        startMeasurement(schedule.settle, finishSample);
+    }
+    else
+    {
+        // only reports the missing calibration
+        getMeasurement();
+        endSample();
+    }
+}
+
+// Enter info for  TIMER1 Interrupt Service Routine here. It only measures its
+// own latency and posts the sample, which runs in PendSV.
+void timer1Isr(void)
+{
+    // The count reloaded at the timeout, so what it has counted since is the latency
+    uint32_t latency = TIMER1_TAILR_R - TIMER1_TAV_R;
+
+    recordLatency(&interruptStats.timerLatency, latency);
+
+    // clear interrupt flag
+    TIMER1_ICR_R = TIMER_ICR_TATOCINT;
+
+    // Periods longer than the 32-bit timer are split into equal ticks. A
+    // deadline that comes while the last sample still runs is dropped, one
+    // that comes while a command holds samples off is kept for the release.
+    if(periodicMode && ++tickCount >= periodTicks)
+    {
+        tickCount = 0;
+
+        if(!sampling && !held)
+        {
+            sampleDeadline = readTimestamp() - (latency / CYCLES_PER_MICROSECOND);
+            deferWork(takeSample);
+        }
+        else if(!sampling && !heldDeadline)
+        {
+            sampleDeadline = readTimestamp() - (latency / CYCLES_PER_MICROSECOND);
+            heldDeadline = true;
+        }
+        else
+        {
+            COUNT_STAT(STAT_DEADLINES);
+        }
+    }
+}
+
+// Start the scheduler tick, one timer wheel slot every TASK_TICK us
+void initSysTick(void)
+{
+    NVIC_ST_CTRL_R    = 0;
+    scheduler.windowStart = readTimestamp();
+    NVIC_ST_RELOAD_R  = (TASK_TICK * CYCLES_PER_MICROSECOND) - 1;
+    NVIC_ST_CURRENT_R = 0;
+    NVIC_ST_CTRL_R    = NVIC_ST_CTRL_CLK_SRC | NVIC_ST_CTRL_INTEN | NVIC_ST_CTRL_ENABLE;
+}
+
+// Advance the task timers, the COUNT flag clears as the ISR is entered
+void sysTickIsr(void)
+{
+    tickScheduler(&scheduler);
+}
+
+// Set up Timer2A as a one-shot alarm counting core clock cycles
+void initAlarm(void)
+{
+    SYSCTL_RCGCTIMER_R |= SYSCTL_RCGCTIMER_R2;
+    _delay_cycles(3);
+
+    TIMER2_CTL_R  &= ~TIMER_CTL_TAEN;
+    TIMER2_CFG_R  = TIMER_CFG_32_BIT_TIMER;
+    TIMER2_TAMR_R = TIMER_TAMR_TAMR_1_SHOT;      // stops at its timeout
+    TIMER2_IMR_R  = TIMER_IMR_TATOIM;
+    NVIC_EN0_R    |= 1 << (INT_TIMER2A - 16);
+}
+
+// Call handler from the Timer2 ISR at an absolute deadline (see wait.h),
+// replacing any alarm pending. A deadline already passed fires straight away.
+void setAlarm(uint32_t deadline, ALARM_HANDLER handler)
+{
+    uint32_t state = _disable_interrupts();
+    int32_t remaining = deadline - readCycleCounter();
+
+    TIMER2_CTL_R   &= ~TIMER_CTL_TAEN;
+    TIMER2_ICR_R   = TIMER_ICR_TATOCINT;
+    alarmHandler   = handler;
+    TIMER2_TAILR_R = (remaining > MIN_ALARM) ? remaining - 1 : MIN_ALARM;
+    TIMER2_TAV_R   = TIMER2_TAILR_R;
+    TIMER2_CTL_R   |= TIMER_CTL_TAEN;
+
+    _restore_interrupts(state);
+}
+
+void cancelAlarm(void)
+{
+    uint32_t state = _disable_interrupts();
+
+    TIMER2_CTL_R &= ~TIMER_CTL_TAEN;
+    TIMER2_ICR_R = TIMER_ICR_TATOCINT;
+    alarmHandler = 0;
+
+    _restore_interrupts(state);
+}
+
+// Run the alarm handler, which may set the next alarm
+void timer2Isr(void)
+{
+    ALARM_HANDLER handler = alarmHandler;
+
+    TIMER2_ICR_R = TIMER_ICR_TATOCINT;
+    alarmHandler = 0;
+
+    if(handler != 0)
+    {
+        handler();
+    }
+}
+
+// Placeholder random number function
+uint32_t random32(void)
+{
+    return TIMER1_TAV_R;
+}
+
+// Split a period in us into the fewest equal timer ticks that fit the 32-bit
+// timer, returns the tick count and the interval load value of one tick
+uint16_t splitPeriod(uint32_t period, uint32_t* load)
+{
+    uint64_t cycles = (uint64_t)period * CYCLES_PER_MICROSECOND;
+    uint16_t ticks = ((cycles - 1) >> 32) + 1;
+
+    // The timer counts load down to 0, so one tick is load + 1 cycles
+    *load = ((cycles + (ticks >> 1)) / ticks) - 1;
+
+    return ticks;
+}
+
+// Start sampling every period us. Returns false, reporting the minimum, if
+// a measurement does not fit in the period.
+bool startPeriodic(uint32_t period)
+{
+    uint32_t minimum = measurementTime();
+
+    if(minimum < MIN_PERIOD)
+    {
+        minimum = MIN_PERIOD;
+    }
+
+    // A period shorter than a measurement would re-enter the ISR straight away
+    if(period < minimum)
+    {
+        sendUart0String("  Period NOT possible, a measurement takes ");
+        sendUart0Unsigned(minimum);
+        sendUart0String(" us.\r\n");
+        return false;
+    }
+
+    periodicValue = period;
+    enableIntTimer1(period);
+
+    return true;
+}
+
+//function to set the period between measurements in us, 0 turns it off
+void periodicT(uint32_t period)
+{
+    if(period == 0)
+    {
+        disableIntTimer1();
+        sendUart0String("  periodic T function is OFF\r\n");
+    }
+    else
+    {
+        startPeriodic(period);
+    }
+}
+
+// Turn-ON vector number 37 (Interrupt 21) for TIMER1A
+void disableIntTimer1(void)
+{
+    TIMER1_CTL_R &= ~TIMER_CTL_TAEN;      // Turn-off timer before reconfiguring
+    TIMER1_IMR_R &= ~TIMER_IMR_TATOIM;
+    NVIC_EN0_R   &= ~(1 << (INT_TIMER1A - INT_GPIOA));
+    periodicMode = false;
+}
+
+// Turn-ON vector number 37 (Interrupt 21) for TIMER1A with a period in us
+void enableIntTimer1(uint32_t period)
+{
+    TIMER1_CTL_R   &= ~TIMER_CTL_TAEN;       // Turn-off timer before reconfiguring
+    TIMER1_CFG_R   = TIMER_CFG_32_BIT_TIMER; // Configure as 32-bit timer (A+B)
+    TIMER1_TAMR_R  = TIMER_TAMR_TAMR_PERIOD; // Configure for periodic mode (count down)
+    loadPeriod(period);                      // Reloads on its own, so samples do not drift
+    resetSchedule(&schedule, period);
+    TIMER1_IMR_R   = TIMER_IMR_TATOIM;       // turn-on interrupts
+    TIMER1_TAV_R   = 0;
+    NVIC_EN0_R     |= (1 << (INT_TIMER1A - INT_GPIOA)); // Turn-on vector number 37, or interrupt 21, (TIMER1A)
+    TIMER1_CTL_R   |= TIMER_CTL_TAEN;        // Turn-on timer
+    periodicMode = true;
+}
+
+// Stop periodic sampling for a command that drives the LEDs or sensor
+// itself, returns true if it was running. A sample already measuring is
+// left to finish.
+bool pauseSampling(void)
+{
+    bool running = periodicMode;
+
+    if(running)
+    {
+        disableIntTimer1();
+    }
+
+    while(sampling);
+
+    return running;
+}
+
+// Restart sampling stopped by pauseSampling(), unless the command changed it
+void resumeSampling(bool running)
+{
+    if(running && !periodicMode)
+    {
+        enableIntTimer1(periodicValue);
+    }
+}
+
+// Hold off sampling while a command changes state it uses, returns true if
+// it was already held. Only the start of a sample is held back: no interrupt
+// is masked, so the tick, timestamp and deferred work run on through a long
+// command, and a timeout in between is serviced late rather than lost. A
+// sample part way through its channels is let finish first.
+bool holdSampling(void)
+{
+    bool wasHeld = held;
+
+    held = true;
+
+    while(sampling);
+
+    return wasHeld;
+}
+
+// Let samples start again, taking the one whose deadline came while held
+void releaseSampling(bool wasHeld)
+{
+    uint32_t state;
+
+    if(wasHeld)
+    {
+        return;
+    }
+
+    // With the ISR shut out, its deadline is either kept here or posted by it
+    state = _disable_interrupts();
+
+    held = false;
+
+    if(heldDeadline && periodicMode)
+    {
+        deferWork(takeSample);
+    }
+
+    heldDeadline = false;
+
+    _restore_interrupts(state);
+}
@@ -1,38 +1,55 @@
-// timers.h
-// William Bozarth
-// Created on: October 7, 2020
-
-//-----------------------------------------------------------------------------
-// Hardware Target
-//-----------------------------------------------------------------------------
-
-// Target Platform: EK-TM4C123GXL Evaluation Board
-// Target uC:       TM4C123GH6PM
-// System Clock:    40 MHz
-
-#ifndef TIMERS_H_
-#define TIMERS_H_
-
-//
-// Includes and Defines
-//
-#include "timers.h"
-
-//
-// Global Variables
-//
-extern bool periodicMode;
-extern uint16_t periodicValue;
-extern int loadValue;
-
-//
-// Definitions
-//
-void initTimer1(void);
-void timer1Isr(void);
-uint32_t random32(void);
-void periodicT(uint16_t loadValue);
-void disableIntTimer1(void);
-void enableIntTimer1(uint16_t period);
-
-#endif /* TIMERS_H_ */
+// timers.h
+// William Bozarth
+// Created on: October 7, 2020
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#ifndef TIMERS_H_
+#define TIMERS_H_
+
+//
+// Includes and Defines
+//
+#include <stdint.h>
+#include <stdbool.h>
+
+#define MIN_PERIOD 1000                          // us, shortest sampling period
+#define MIN_ALARM  20                            // cycles, an alarm set later than its deadline fires after this
+
+typedef void (*ALARM_HANDLER)(void);
+
+//
+// Global Variables
+//
+extern bool periodicMode;
+extern uint32_t periodicValue;                   // period in us
+
+//
+// Definitions
+//
+void initTimer1(void);
+void timer1Isr(void);
+void initSysTick(void);
+void sysTickIsr(void);
+void initAlarm(void);
+void setAlarm(uint32_t deadline, ALARM_HANDLER handler);
+void cancelAlarm(void);
+void timer2Isr(void);
+uint32_t random32(void);
+uint16_t splitPeriod(uint32_t period, uint32_t* load);
+bool startPeriodic(uint32_t period);
+void periodicT(uint32_t period);
+void disableIntTimer1(void);
+void enableIntTimer1(uint32_t period);
+bool pauseSampling(void);
+void resumeSampling(bool running);
+bool holdSampling(void);
+void releaseSampling(bool wasHeld);
+
+#endif /* TIMERS_H_ */
@@ -0,0 +1,110 @@
+// timestamp.c
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+// 64-bit monotonic time in us since boot. Wide Timer 0A counts down once per
+// us from its prescaler and wraps every 71 minutes; its timeout ISR counts
+// the wraps, which form the upper 32 bits.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "tm4c123gh6pm.h"
+#include "uart0.h"
+#include "format.h"
+#include "clock.h"
+#include "timestamp.h"
+
+bool stampMode = false;
+
+// Wraps of the timer counted by its ISR
+static volatile uint32_t timeHigh = 0;
+
+// Start the us count from 0
+void initTimestamp(void)
+{
+    SYSCTL_RCGCWTIMER_R |= SYSCTL_RCGCWTIMER_R0;
+    _delay_cycles(3);
+
+    WTIMER0_CTL_R   &= ~TIMER_CTL_TAEN;
+    WTIMER0_CFG_R   = TIMER_CFG_16_BIT;          // 32-bit halves of the 64-bit timer
+    WTIMER0_TAMR_R  = TIMER_TAMR_TAMR_PERIOD;    // count down, true prescaler
+    WTIMER0_TAPR_R  = SYSTEM_CLOCK_MHZ - 1;      // one count per us
+    WTIMER0_TAILR_R = 0xFFFFFFFF;
+    WTIMER0_TAV_R   = 0xFFFFFFFF;
+    WTIMER0_ICR_R   = TIMER_ICR_TATOCINT;
+    WTIMER0_IMR_R   = TIMER_IMR_TATOIM;
+    NVIC_EN2_R      |= 1 << (INT_WTIMER0A - 16 - 64);
+    WTIMER0_CTL_R   |= TIMER_CTL_TAEN;
+}
+
+// Count a wrap of the timer
+void wideTimer0Isr(void)
+{
+    WTIMER0_ICR_R = TIMER_ICR_TATOCINT;
+    timeHigh++;
+}
+
+// Combine the wraps counted so far with a timer count read after them. A
+// wrap whose ISR has not run yet shows as a pending timeout; it belongs to
+// the count only if the count restarted after it, near the top.
+uint64_t extendTimestamp(uint32_t high, uint32_t count, bool wrapped)
+{
+    uint32_t low = 0xFFFFFFFF - count;
+
+    if(wrapped && low < TIMESTAMP_WRAP_HALF)
+    {
+        high++;
+    }
+
+    return ((uint64_t)high << 32) | low;
+}
+
+// Returns the time in us since boot, from any context
+uint64_t readTimestamp(void)
+{
+    uint32_t state = _disable_interrupts();
+    uint32_t high = timeHigh;
+    uint32_t count = WTIMER0_TAV_R;
+    bool wrapped = (WTIMER0_RIS_R & TIMER_RIS_TATORIS) != 0;
+
+    _restore_interrupts(state);
+
+    return extendTimestamp(high, count, wrapped);
+}
+
+// Print a time in us as seconds with six decimals
+void sendUart0Timestamp(uint64_t time)
+{
+    char str[FORMAT_NUMBER_LENGTH];
+    uint32_t micro = time % 1000000;
+    uint8_t length, i;
+
+    sendUart0Unsigned((uint32_t)(time / 1000000));
+    putcUart0('.');
+
+    length = formatUnsigned(str, micro);
+    for(i = length; i < 6; i++)
+    {
+        putcUart0('0');
+    }
+
+    sendUart0String(str);
+}
+
+// Start a sample record with its time and a separator when stamps are on
+void sendUart0Stamp(uint64_t time, char separator)
+{
+    if(stampMode)
+    {
+        sendUart0Timestamp(time);
+        putcUart0(separator);
+    }
+}
@@ -0,0 +1,39 @@
+// timestamp.h
+// William Bozarth
+// Created on: October 19, 2026
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#ifndef TIMESTAMP_H_
+#define TIMESTAMP_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//
+// Defines
+//
+#define TIMESTAMP_WRAP_HALF 0x80000000           // us, half the range of the timer count
+
+//
+// Global Variables
+//
+extern bool stampMode;                           // prefix each sample record with its time
+
+//
+// Definitions
+//
+void initTimestamp(void);
+void wideTimer0Isr(void);
+uint64_t extendTimestamp(uint32_t high, uint32_t count, bool wrapped);
+uint64_t readTimestamp(void);
+void sendUart0Timestamp(uint64_t time);
+void sendUart0Stamp(uint64_t time, char separator);
+
+#endif /* TIMESTAMP_H_ */
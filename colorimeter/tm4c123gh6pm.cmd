@@ -10,7 +10,8 @@
 
 MEMORY
 {
-    FLASH (RX) : origin = 0x00000000, length = 0x00040000
+    FLASH (RX) : origin = 0x00000000, length = 0x00010000
+    LOG   (R)  : origin = 0x00010000, length = 0x00030000
     SRAM (RWX) : origin = 0x20000000, length = 0x00008000
 }
 
@@ -43,3 +44,11 @@ SECTIONS
 }
 
 __STACK_TOP = __stack + 512;
+
+/* The measurement log (logger.c) owns the flash above the program in        */
+/* whole 1 KB pages. Move both bounds and grow FLASH if the program          */
+/* outgrows it. The last page holds the copy of the colors while they are   */
+/* moved into the EEPROM journal (eeprom.c).                                 */
+__LOG_START = 0x00010000;
+__LOG_END   = 0x0003FC00;
+__MIGRATION_PAGE = 0x0003FC00;
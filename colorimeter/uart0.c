@@ -1,194 +1,248 @@
-// uart0.c
-// William Bozarth
-// Created on: October 7, 2020
-
-//-----------------------------------------------------------------------------
-// Hardware Target
-//-----------------------------------------------------------------------------
-
-// Target Platform: EK-TM4C123GXL Evaluation Board
-// Target uC:       TM4C123GH6PM
-// System Clock:    40 MHz
-
-#include <stdint.h>
-#include <stdbool.h>
-#include <string.h>
-#include "tm4c123gh6pm.h"
-#include "gpio.h"
-#include "uart0.h"
-
-UART0_BUFFER uart0Info = {0};
-
-// Initialize UART0
-void initUart0(void)
-{
-    // Enable clocks
-    SYSCTL_RCGCUART_R |= SYSCTL_RCGCUART_R0;
-    _delay_cycles(3);
-
-    enablePort(PORTA);
-    _delay_cycles(3);
-
-    // Configure UART0 pins
-    selectPinPushPullOutput(UART0_TX);
-    selectPinDigitalInput(UART0_RX);
-    setPinAuxFunction(UART0_TX, GPIO_PCTL_PA1_U0TX);
-    setPinAuxFunction(UART0_RX, GPIO_PCTL_PA0_U0RX);
-
-    // Configure UART0 with default baud rate
-    UART0_CTL_R = 0;                                    // turn-off UART0 to allow safe programming
-    UART0_CC_R  = UART_CC_CS_SYSCLK;                     // use system clock (usually 40 MHz)
-}
-
-// Set baud rate as function of instruction cycle frequency
-void setUart0BaudRate(uint32_t baudRate, uint32_t fcyc)
-{
-    uint32_t divisorTimes128 = (fcyc * 8) / baudRate;   // calculate divisor (r) in units of 1/128,
-                                                        // where r = fcyc / 16 * baudRate
-    UART0_CTL_R  = 0;                                   // turn-off UART0 to allow safe programming
-    UART0_IBRD_R = divisorTimes128 >> 7;                // set integer value to floor(r)
-    UART0_FBRD_R = ((divisorTimes128 + 1) >> 1) & 63;   // set fractional value to round(fract(r)*64)
-    UART0_LCRH_R = UART_LCRH_WLEN_8;                    // configure for 8N1 w/ 16-level FIFO
-    UART0_CTL_R  = UART_CTL_TXE | UART_CTL_RXE | UART_CTL_UARTEN; // turn-on UART0
-    UART0_IM_R   = UART_IM_TXIM;                        // turn-on TX interrupt
-    NVIC_EN0_R   |= 1 << (INT_UART0-16);                // turn-on interrupt 21 (UART0)
-}
-
-
-// Returns the status of the receive buffer
-bool kbhitUart0(void)
-{
-    return !(UART0_FR_R & UART_FR_RXFE);
-}
-
-// Blocking function that returns with serial data once the buffer is not empty
-char getcUart0(void)
-{
-    return UART0_DR_R & 0xFF; // get character from fifo
-}
-
-// Add characters to UART0 TX FIFO
-void sendUart0String(char str[])
-{
-    int i = 0;
-
-    // Write string to Tx Ring Buffer
-    while(str[i] != '\0')
-    {
-        // If NOT full write next Character
-        if(!(fullRingBuffer()))
-        {
-            writeToQueue(str[i]);
-            i++;
-        }
-    }
-
-    UART0_ICR_R = 0x00000FFF;
-    // Check to see if UART Tx holding register is empty
-    if(UART0_FR_R & UART_FR_TXFE  && !(emptyRingBuffer()))
-    {
-        UART0_DR_R = readFromQueue(); // "Prime Pump" by writing 1st char to Uart0
-    }
-}
-
-// Add characters to UART0 TX FIFO
-void sendUart0StringLiteral(const char str[])
-{
-    int i = 0;
-
-    // Write string to Tx Ring Buffer
-    while(str[i] != '\0')
-    {
-        // If NOT full write next Character
-        if(!(fullRingBuffer()))
-        {
-            writeToQueue(str[i]);
-            i++;
-        }
-    }
-
-    UART0_ICR_R = 0x00000FFF;
-    // Check to see if UART Tx holding register is empty
-    if(UART0_FR_R & UART_FR_TXFE  && !(emptyRingBuffer()))
-    {
-        UART0_DR_R = readFromQueue(); // "Prime Pump" by writing 1st char to Uart0
-    }
-}
-
-// Update current position of writeIndex variable for Ring Buffer
-void writeToQueue(char c)
-{
-    uart0Info.uart0String[uart0Info.writeIndex] = c;
-    uart0Info.writeIndex = (uart0Info.writeIndex + 1) % QUEUE_BUFFER_LENGTH;
-}
-
-// Update current position of readIndex variable for Ring Buffer
-char readFromQueue(void)
-{
-    char c;
-    c = uart0Info.uart0String[uart0Info.readIndex];
-    uart0Info.readIndex = (uart0Info.readIndex + 1) % QUEUE_BUFFER_LENGTH;
-    return c;
-}
-
-// Returns true if ring buffer is EMPTY
-bool emptyRingBuffer(void)
-{
-    bool ok = false;
-
-    if(uart0Info.writeIndex == uart0Info.readIndex)
-    {
-        ok = true;
-    }
-
-    return ok;
-}
-
-// Returns true if ring buffer is FULL
-bool fullRingBuffer(void)
-{
-    bool ok = false;
-
-    if(((uart0Info.writeIndex + 1) % QUEUE_BUFFER_LENGTH) == uart0Info.readIndex)
-    {
-        ok = true;
-    }
-
-    return ok;
-}
-
-// Function to Print Main Menu
-void printMainMenu(void)
-{
-    sendUart0String("\r\n");
-    sendUart0String("Commands: \r\n");
-    sendUart0String("    calibrate N\r\n");
-    sendUart0String("    color N\r\n");
-    sendUart0String("    erase N\r\n");
-    sendUart0String("    periodic T\r\n");
-    sendUart0String("    delta D\r\n");
-    sendUart0String("    match E\r\n");
-    sendUart0String("    trigger\r\n");
-    sendUart0String("    button\r\n");
-    sendUart0String("    led OFF|ON|SAMPLE\r\n");
-    sendUart0String("    test\r\n");
-    sendUart0String("    print ON|OFF|COLORS\r\n");
-    sendUart0String("    reboot\r\n");
-    sendUart0String("\r\n");
-}
-
-// Handle UART0 Interrupts
-void uart0Isr(void)
-{
-    // Writing a 1 to the bits in this register clears the bits in the UARTRIS and UARTMIS registers
-    UART0_ICR_R = 0xFFF;
-
-    // Check to see if UART Tx holding register is empty and send next byte of data
-    if((UART0_FR_R & UART_FR_TXFE) && !(emptyRingBuffer()))
-    {
-        UART0_DR_R = readFromQueue();
-    }
-}
-
-
-
+// uart0.c
+// William Bozarth
+// Created on: October 7, 2020
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target Platform: EK-TM4C123GXL Evaluation Board
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "tm4c123gh6pm.h"
+#include "gpio.h"
+#include "uart0.h"
+#include "tasks.h"
+#include "profile.h"
+#include "stats.h"
+
+UART0_BUFFER uart0Info = {0};
+
+// Initialize UART0
+void initUart0(void)
+{
+    // Enable clocks
+    SYSCTL_RCGCUART_R |= SYSCTL_RCGCUART_R0;
+    _delay_cycles(3);
+
+    enablePort(PORTA);
+    _delay_cycles(3);
+
+    // Configure UART0 pins
+    selectPinPushPullOutput(UART0_TX);
+    selectPinDigitalInput(UART0_RX);
+    setPinAuxFunction(UART0_TX, GPIO_PCTL_PA1_U0TX);
+    setPinAuxFunction(UART0_RX, GPIO_PCTL_PA0_U0RX);
+
+    // Configure UART0 with default baud rate
+    UART0_CTL_R = 0;                                    // turn-off UART0 to allow safe programming
+    UART0_CC_R  = UART_CC_CS_SYSCLK;                     // use system clock (SYSTEM_CLOCK)
+}
+
+// Set baud rate as function of instruction cycle frequency
+void setUart0BaudRate(uint32_t baudRate, uint32_t fcyc)
+{
+    uint32_t divisorTimes128 = (fcyc * 8) / baudRate;   // calculate divisor (r) in units of 1/128,
+                                                        // where r = fcyc / 16 * baudRate
+    UART0_CTL_R  = 0;                                   // turn-off UART0 to allow safe programming
+    UART0_IBRD_R = divisorTimes128 >> 7;                // set integer value to floor(r)
+    UART0_FBRD_R = ((divisorTimes128 + 1) >> 1) & 63;   // set fractional value to round(fract(r)*64)
+    UART0_LCRH_R = UART_LCRH_WLEN_8;                    // configure for 8N1 w/ 16-level FIFO
+    UART0_CTL_R  = UART_CTL_TXE | UART_CTL_RXE | UART_CTL_UARTEN; // turn-on UART0
+    UART0_IM_R   = UART_IM_TXIM | UART_IM_RXIM | UART_IM_OEIM; // turn-on TX, RX and overrun interrupts
+    NVIC_EN0_R   |= 1 << (INT_UART0-16);                // turn-on interrupt 21 (UART0)
+}
+
+
+// Returns the status of the receive buffer
+bool kbhitUart0(void)
+{
+    return !(UART0_FR_R & UART_FR_RXFE);
+}
+
+// Blocking function that returns with serial data once the buffer is not empty
+char getcUart0(void)
+{
+    return UART0_DR_R & 0xFF; // get character from fifo
+}
+
+// Start sending the Tx Ring Buffer if UART0 is idle. The shell and the
+// sampling ISR both write the ring, so each access runs with interrupts off.
+void primeUart0(void)
+{
+    uint32_t state = _disable_interrupts();
+
+    UART0_ICR_R = UART_ICR_TXIC;            // a pending Rx interrupt still has to wake the shell
+    // Check to see if UART Tx holding register is empty
+    if(UART0_FR_R & UART_FR_TXFE  && !(emptyRingBuffer()))
+    {
+        UART0_DR_R = readFromQueue(); // "Prime Pump" by writing 1st char to Uart0
+    }
+
+    _restore_interrupts(state);
+}
+
+// Add a character to the Tx Ring Buffer, waiting while the buffer is full.
+// The check and the write are one critical section, so a sample printed
+// from the timer ISR can never take the slot found free here.
+void putcUart0(char c)
+{
+    uint32_t state;
+    bool written = false, waited = false;
+
+    while(!written)
+    {
+        state = _disable_interrupts();
+
+        if(!fullRingBuffer())
+        {
+            writeToQueue(c);
+            written = true;
+        }
+        else if(!waited)
+        {
+            COUNT_STAT(STAT_TX_FULL);
+            waited = true;
+        }
+
+        _restore_interrupts(state);
+
+        if(!written)
+        {
+            primeUart0();
+        }
+    }
+}
+
+// Add characters to UART0 TX FIFO
+void sendUart0String(char str[])
+{
+    sendUart0StringLiteral(str);
+}
+
+// Add characters to UART0 TX FIFO
+void sendUart0StringLiteral(const char str[])
+{
+    int i = 0;
+
+    // Write string to Tx Ring Buffer
+    while(str[i] != '\0')
+    {
+        putcUart0(str[i++]);
+    }
+
+    primeUart0();
+}
+
+// Update current position of writeIndex variable for Ring Buffer
+void writeToQueue(char c)
+{
+    uart0Info.uart0String[uart0Info.writeIndex] = c;
+    uart0Info.writeIndex = (uart0Info.writeIndex + 1) % QUEUE_BUFFER_LENGTH;
+}
+
+// Update current position of readIndex variable for Ring Buffer
+char readFromQueue(void)
+{
+    char c;
+    c = uart0Info.uart0String[uart0Info.readIndex];
+    uart0Info.readIndex = (uart0Info.readIndex + 1) % QUEUE_BUFFER_LENGTH;
+    return c;
+}
+
+// Returns true if ring buffer is EMPTY
+bool emptyRingBuffer(void)
+{
+    bool ok = false;
+
+    if(uart0Info.writeIndex == uart0Info.readIndex)
+    {
+        ok = true;
+    }
+
+    return ok;
+}
+
+// Returns true if ring buffer is FULL
+bool fullRingBuffer(void)
+{
+    bool ok = false;
+
+    if(((uart0Info.writeIndex + 1) % QUEUE_BUFFER_LENGTH) == uart0Info.readIndex)
+    {
+        ok = true;
+    }
+
+    return ok;
+}
+
+// Function to Print Main Menu
+void printMainMenu(void)
+{
+    sendUart0String("\r\n");
+    sendUart0String("Commands: \r\n");
+    sendUart0String("    calibrate N\r\n");
+    sendUart0String("    color N [K]\r\n");
+    sendUart0String("    erase N\r\n");
+    sendUart0String("    periodic [T [HZ|MS|US]]\r\n");
+    sendUart0String("    overrun SKIP|STRETCH|DEGRADE\r\n");
+    sendUart0String("    settle [US]\r\n");
+    sendUart0String("    delta D\r\n");
+    sendUart0String("    match E [RGB|LAB]\r\n");
+    sendUart0String("    rank K [TEXT|CSV]\r\n");
+    sendUart0String("    stable N [M] [D]|OFF\r\n");
+    sendUart0String("    cache [EPSILON|OFF]\r\n");
+    sendUart0String("    commit [AUTO|MANUAL]\r\n");
+    sendUart0String("    log [ON|OFF|CLEAR]\r\n");
+    sendUart0String("    dump\r\n");
+    sendUart0String("    irq\r\n");
+    sendUart0String("    tasks\r\n");
+    sendUart0String("    prof [RESET]\r\n");
+    sendUart0String("    stats [TEXT|BIN [S]|RESET|OFF]\r\n");
+    sendUart0String("    time [ON|OFF]\r\n");
+    sendUart0String("    trigger\r\n");
+    sendUart0String("    button\r\n");
+    sendUart0String("    led OFF|ON|SAMPLE\r\n");
+    sendUart0String("    test\r\n");
+    sendUart0String("    print ON|OFF|DELTA|TABLE|COLORS\r\n");
+    sendUart0String("    reboot\r\n");
+    sendUart0String("    macro NAME = CMD; CMD\r\n");
+    sendUart0String("    CMD; CMD; ...\r\n");
+    sendUart0String("\r\n");
+}
+
+// Handle UART0 Interrupts
+void uart0Isr(void)
+{
+    PROFILE_BEGIN(PROBE_UART_ISR);
+
+    // A received character wakes the shell, which reads it from the data register
+    if(UART0_MIS_R & UART_MIS_RXMIS)
+    {
+        postTask(&scheduler, TASK_SHELL);
+    }
+
+    // The shell fell behind and the Rx FIFO dropped a character
+    if(UART0_MIS_R & UART_MIS_OEMIS)
+    {
+        COUNT_STAT(STAT_RX_OVERRUN);
+    }
+
+    // Writing a 1 to the bits in this register clears the bits in the UARTRIS and UARTMIS registers
+    UART0_ICR_R = 0xFFF;
+
+    // Check to see if UART Tx holding register is empty and send next byte of data
+    if((UART0_FR_R & UART_FR_TXFE) && !(emptyRingBuffer()))
+    {
+        UART0_DR_R = readFromQueue();
+    }
+
+    PROFILE_END(PROBE_UART_ISR);
+}
+
+
+
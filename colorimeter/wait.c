@@ -1,36 +1,57 @@
-// Wait functions
-// Jason Losh
-
-//-----------------------------------------------------------------------------
-// Hardware Target
-//-----------------------------------------------------------------------------
-
-// Target uC:       TM4C123GH6PM
-// System Clock:    40 MHz
-
-//-----------------------------------------------------------------------------
-// Device includes, defines, and assembler directives
-//-----------------------------------------------------------------------------
-
-#include "wait.h"
-
-//-----------------------------------------------------------------------------
-// Subroutines
-//-----------------------------------------------------------------------------
-
-// Approximate busy waiting (in units of microseconds), given a 40 MHz system clock
-void waitMicrosecond(uint32_t us)
-{
-    __asm("WMS_LOOP0:   MOV  R1, #6");          // 1
-    __asm("WMS_LOOP1:   SUB  R1, #1");          // 6
-    __asm("             CBZ  R1, WMS_DONE1");   // 5+1*3
-    __asm("             NOP");                  // 5
-    __asm("             NOP");                  // 5
-    __asm("             B    WMS_LOOP1");       // 5*2 (speculative, so P=1)
-    __asm("WMS_DONE1:   SUB  R0, #1");          // 1
-    __asm("             CBZ  R0, WMS_DONE0");   // 1
-    __asm("             NOP");                  // 1
-    __asm("             B    WMS_LOOP0");       // 1*2 (speculative, so P=1)
-    __asm("WMS_DONE0:");                        // ---
-                                                // 40 clocks/us + error
-}
+// Wait functions
+// Jason Losh
+
+//-----------------------------------------------------------------------------
+// Hardware Target
+//-----------------------------------------------------------------------------
+
+// Target uC:       TM4C123GH6PM
+// System Clock:    80 MHz
+
+//-----------------------------------------------------------------------------
+// Device includes, defines, and assembler directives
+//-----------------------------------------------------------------------------
+
+#include "cycles.h"
+#include "wait.h"
+
+// Waits and timeouts run to absolute deadlines on the free-running DWT cycle
+// counter. An ISR that preempts a wait delays only the check after it, it
+// does not stretch the wait, and the timing follows the core clock.
+
+//-----------------------------------------------------------------------------
+// Subroutines
+//-----------------------------------------------------------------------------
+
+// Returns the deadline us from now, us must be at most MAX_DEADLINE
+uint32_t deadlineAfter(uint32_t us)
+{
+    return readCycleCounter() + (us * CYCLES_PER_MICROSECOND);
+}
+
+// Returns true once the deadline has passed, valid until MAX_DEADLINE after it
+bool deadlinePassed(uint32_t deadline)
+{
+    return (int32_t)(readCycleCounter() - deadline) >= 0;
+}
+
+// Busy wait until a deadline
+void waitUntil(uint32_t deadline)
+{
+    while(!deadlinePassed(deadline));
+}
+
+// Busy wait (in units of microseconds), longer waits run as consecutive deadlines
+void waitMicrosecond(uint32_t us)
+{
+    uint32_t deadline = readCycleCounter();
+
+    while(us > MAX_DEADLINE)
+    {
+        deadline += MAX_DEADLINE * CYCLES_PER_MICROSECOND;
+        waitUntil(deadline);
+        us -= MAX_DEADLINE;
+    }
+
+    waitUntil(deadline + (us * CYCLES_PER_MICROSECOND));
+}
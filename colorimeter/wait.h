@@ -1,16 +1,25 @@
-/*
- * wait.h
- *
- *  Created on: Feb 13, 2020
- *      Author: willi
- */
-
-#ifndef WAIT_H_
-#define WAIT_H_
-
-#include <stdint.h>
-#include "tm4c123gh6pm.h"
-
-void waitMicrosecond(uint32_t us);
-
-#endif /* WAIT_H_ */
+/*
+ * wait.h
+ *
+ *  Created on: Feb 13, 2020
+ *      Author: willi
+ */
+
+#ifndef WAIT_H_
+#define WAIT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "tm4c123gh6pm.h"
+#include "cycles.h"
+
+// Longest deadline in us, half the cycle counter range so passed deadlines
+// still compare as passed
+#define MAX_DEADLINE (0x7FFFFFFF / CYCLES_PER_MICROSECOND)
+
+uint32_t deadlineAfter(uint32_t us);
+bool deadlinePassed(uint32_t deadline);
+void waitUntil(uint32_t deadline);
+void waitMicrosecond(uint32_t us);
+
+#endif /* WAIT_H_ */